@@ -0,0 +1,174 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_DrawThickLine() and
+ u8g2_DrawFilledArc() with faking the thickness with overlapping lines
+ and discs, for a 5 pixel wide gauge needle and a 6 pixel wide progress
+ arc, for a vertical_top_lsb buffer (SSD1306) and a horizontal_right_lsb
+ buffer (ST7920). Before timing, it checks that a full filled arc has
+ the pixels of u8g2_DrawDisc(), and that a filled arc covers its
+ u8g2_DrawArc() outline and stays inside the disc.
+
+ No display is required.
+
+ Usage: ex_bench_arc [draws_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CX 64
+#define CY 40
+#define RAD 30
+#define NEEDLE_W 5
+#define ARC_W 6
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// The needle as overlapping 1 pixel lines, one for each offset of a
+// NEEDLE_W x NEEDLE_W square
+static void fake_needle(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1)
+{
+  for (int i = -NEEDLE_W / 2; i <= NEEDLE_W / 2; i++)
+    for (int j = -NEEDLE_W / 2; j <= NEEDLE_W / 2; j++)
+      u8g2_DrawLine(u8g2, CX + i, CY + j, x1 + i, y1 + j);
+}
+
+// The arc from angle 0 to end (256 steps for a full circle) as
+// overlapping discs, one for each angle step
+static void fake_arc(u8g2_t *u8g2, int end)
+{
+  for (int a = 0; a <= end; a++) {
+    double r = (RAD - ARC_W / 2.0) + 0.5;
+    u8g2_DrawDisc(u8g2, CX + lround(r * cos(a * M_PI / 128)),
+                  CY - lround(r * sin(a * M_PI / 128)), ARC_W / 2,
+                  U8G2_DRAW_ALL);
+  }
+}
+
+// 0: fake needle, 1: u8g2_DrawThickLine(), 2: fake arc,
+// 3: u8g2_DrawFilledArc()
+static void draw_shape(u8g2_t *u8g2, int method, int angle)
+{
+  u8g2_uint_t x1 = CX + lround(RAD * cos(angle * M_PI / 128));
+  u8g2_uint_t y1 = CY - lround(RAD * sin(angle * M_PI / 128));
+  switch (method) {
+  case 0:
+    fake_needle(u8g2, x1, y1);
+    break;
+  case 1:
+    u8g2_DrawThickLine(u8g2, CX, CY, x1, y1, NEEDLE_W);
+    break;
+  case 2:
+    fake_arc(u8g2, angle);
+    break;
+  default:
+    u8g2_DrawFilledArc(u8g2, CX, CY, RAD, RAD - ARC_W, 0, angle);
+    break;
+  }
+}
+
+// Draw the shape for angles of up to a half circle, and return draws
+// per second
+static double test_draws(u8g2_t *u8g2, int method, long draws)
+{
+  double start = now_secs();
+  for (long i = 0; i < draws; i++)
+    draw_shape(u8g2, method, 1 + i % 128);
+  return draws / (now_secs() - start);
+}
+
+// Draw one shape on a cleared buffer and copy the buffer to buf
+// 0: u8g2_DrawFilledArc(), 1: u8g2_DrawDisc(), 2: u8g2_DrawArc()
+static void draw_check_shape(u8g2_t *u8g2, int shape, u8g2_uint_t rad,
+                             uint8_t start, uint8_t end, uint8_t *buf)
+{
+  size_t buf_size = buffer_size(u8g2);
+  memset(u8g2->tile_buf_ptr, 0, buf_size);
+  if (shape == 0)
+    u8g2_DrawFilledArc(u8g2, 64, 32, rad, 0, start, end);
+  else if (shape == 1)
+    u8g2_DrawDisc(u8g2, 64, 32, rad, U8G2_DRAW_ALL);
+  else
+    u8g2_DrawArc(u8g2, 64, 32, rad, start, end);
+  memcpy(buf, u8g2->tile_buf_ptr, buf_size);
+}
+
+// Check the filled arcs against the discs and arc outlines of the same
+// radius, for every radius that fits on the display
+static void check_filled_arc(u8g2_t *u8g2)
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *arc = (uint8_t *)malloc(buf_size);
+  uint8_t *disc = (uint8_t *)malloc(buf_size);
+  uint8_t *outline = (uint8_t *)malloc(buf_size);
+  u8g2_SetDrawColor(u8g2, 1);
+  for (u8g2_uint_t rad = 0; rad < 32; rad++) {
+    draw_check_shape(u8g2, 0, rad, 0, 0, arc);
+    draw_check_shape(u8g2, 1, rad, 0, 0, disc);
+    if (memcmp(arc, disc, buf_size) != 0) {
+      fprintf(stderr, "radius %d: full filled arc differs from disc\n", rad);
+      exit(1);
+    }
+    for (int start = 0; start < 256; start += 8) {
+      for (int end = start + 3; end < start + 256; end += 8) {
+        draw_check_shape(u8g2, 0, rad, start, end, arc);
+        draw_check_shape(u8g2, 2, rad, start, end, outline);
+        for (size_t i = 0; i < buf_size; i++) {
+          if ((arc[i] & ~disc[i]) || (outline[i] & ~arc[i])) {
+            fprintf(stderr, "radius %d, angles %d-%d: filled arc is not "
+                    "between outline and disc\n", rad, start, end & 255);
+            exit(1);
+          }
+        }
+      }
+    }
+  }
+  free(arc);
+  free(disc);
+  free(outline);
+}
+
+int main(int argc, char *argv[])
+{
+  long draws = (argc > 1) ? atol(argv[1]) : 20000;
+
+  const char *buffer_names[] = {"vertical", "horizontal"};
+  const char *shape_names[] = {"needle", "arc"};
+  printf("%-10s %-6s %16s %16s %8s\n", "buffer", "shape", "fake draws/s",
+         "u8g2 draws/s", "speedup");
+  for (int buf = 0; buf < 2; buf++) {
+    u8g2_t u8g2;
+    if (buf == 0)
+      u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                         u8x8_dummy_cb);
+    else
+      u8g2_Setup_st7920_s_128x64_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                   u8x8_dummy_cb);
+    check_filled_arc(&u8g2);
+    u8g2_SetDrawColor(&u8g2, 1);
+    for (int shape = 0; shape < 2; shape++) {
+      double a = test_draws(&u8g2, shape * 2, draws);
+      double b = test_draws(&u8g2, shape * 2 + 1, draws);
+      printf("%-10s %-6s %16.0f %16.0f %7.2fx\n", buffer_names[buf],
+             shape_names[shape], a, b, b / a);
+    }
+  }
+
+  return 0;
+}
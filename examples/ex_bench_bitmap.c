@@ -0,0 +1,150 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_DrawXBM() with drawing
+ the bitmap a pixel at a time (the previous implementation), for a
+ 128x64 splash image and a 16x16 icon, in each display rotation, for a
+ vertical_top_lsb buffer (SSD1306) and a horizontal_right_lsb buffer
+ (ST7920)
+
+ No display is required.
+
+ Usage: ex_bench_bitmap [draws_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// u8g2_DrawXBM() drawn a pixel at a time, with a clipped line of length
+// 1 for each pixel
+static void xbm_pixels(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
+                       u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  uint8_t color = u8g2->draw_color;
+  uint8_t ncolor = (color == 0 ? 1 : 0);
+  u8g2_uint_t blen = (w + 7) / 8;
+  for (u8g2_uint_t j = 0; j < h; j++) {
+    for (u8g2_uint_t i = 0; i < w; i++) {
+      if (bitmap[j * blen + i / 8] & (1 << (i % 8))) {
+        u8g2->draw_color = color;
+        u8g2_DrawHVLine(u8g2, x + i, y + j, 1, 0);
+      }
+      else if (u8g2->bitmap_transparency == 0) {
+        u8g2->draw_color = ncolor;
+        u8g2_DrawHVLine(u8g2, x + i, y + j, 1, 0);
+      }
+    }
+  }
+  u8g2->draw_color = color;
+}
+
+typedef void (*draw_xbm_fn)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
+                            u8g2_uint_t w, u8g2_uint_t h,
+                            const uint8_t *bitmap);
+
+// Draw the bitmap at positions across the display with each draw colour
+// and bitmap mode, and return draws per second
+static double test_draws(u8g2_t *u8g2, draw_xbm_fn draw, u8g2_uint_t w,
+                         u8g2_uint_t h, const uint8_t *bitmap, long draws)
+{
+  u8g2_uint_t width = u8g2_GetDisplayWidth(u8g2);
+  u8g2_uint_t height = u8g2_GetDisplayHeight(u8g2);
+  double start = now_secs();
+  for (long i = 0; i < draws; i++) {
+    u8g2_SetDrawColor(u8g2, i % 3);
+    u8g2_SetBitmapMode(u8g2, (i / 3) % 2);
+    draw(u8g2, (i * 7) % (width - w + 1), (i * 5) % (height - h + 1), w, h,
+         bitmap);
+  }
+  return draws / (now_secs() - start);
+}
+
+// Check that the two procedures give the same buffer
+static void check_same(u8g2_t *u8g2, const uint8_t *bitmap)
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  for (int pass = 0; pass < 2; pass++) {
+    srand(1);
+    memset(u8g2->tile_buf_ptr, 0x5a, buf_size);
+    for (int i = 0; i < 2000; i++) {
+      u8g2_uint_t w = 1 + rand() % 64;
+      u8g2_uint_t h = 1 + rand() % 64;
+      u8g2_uint_t x = rand() % 160 - 16;
+      u8g2_uint_t y = rand() % 160 - 16;
+      u8g2_SetDrawColor(u8g2, rand() % 3);
+      u8g2_SetBitmapMode(u8g2, rand() % 2);
+      if (pass == 0)
+        xbm_pixels(u8g2, x, y, w, h, bitmap);
+      else
+        u8g2_DrawXBM(u8g2, x, y, w, h, bitmap);
+    }
+    if (pass == 0)
+      memcpy(ref, u8g2->tile_buf_ptr, buf_size);
+    else if (memcmp(ref, u8g2->tile_buf_ptr, buf_size) != 0) {
+      fprintf(stderr, "buffers differ\n");
+      exit(1);
+    }
+  }
+  free(ref);
+}
+
+int main(int argc, char *argv[])
+{
+  long draws = (argc > 1) ? atol(argv[1]) : 2000;
+
+  // Random pixels, large enough for the 128x64 image
+  uint8_t bitmap[128 / 8 * 64];
+  srand(1);
+  for (size_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = rand();
+
+  const u8g2_cb_t *rotations[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3};
+  const char *buffer_names[] = {"vertical", "horizontal"};
+  printf("%-10s %3s %7s %16s %16s %8s\n", "buffer", "rot", "bitmap",
+         "pixels draws/s", "u8g2 draws/s", "speedup");
+  for (int buf = 0; buf < 2; buf++) {
+    for (int rot = 0; rot < 4; rot++) {
+      u8g2_t u8g2;
+      if (buf == 0)
+        u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, rotations[rot],
+                                           u8x8_byte_empty, u8x8_dummy_cb);
+      else
+        u8g2_Setup_st7920_s_128x64_f(&u8g2, rotations[rot], u8x8_byte_empty,
+                                     u8x8_dummy_cb);
+      check_same(&u8g2, bitmap);
+
+      u8g2_uint_t w = u8g2_GetDisplayWidth(&u8g2);
+      u8g2_uint_t h = u8g2_GetDisplayHeight(&u8g2);
+      const u8g2_uint_t sizes[2][2] = {{w, h}, {16, 16}};
+      for (int i = 0; i < 2; i++) {
+        double a = test_draws(&u8g2, xbm_pixels, sizes[i][0], sizes[i][1],
+                              bitmap, draws);
+        double b = test_draws(&u8g2, u8g2_DrawXBM, sizes[i][0], sizes[i][1],
+                              bitmap, draws * 10);
+        char size[16];
+        snprintf(size, sizeof(size), "%dx%d", sizes[i][0], sizes[i][1]);
+        printf("%-10s %3d %7s %16.0f %16.0f %7.2fx\n", buffer_names[buf],
+               rot * 90, size, a, b, b / a);
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_DrawCircle() and
+ u8g2_DrawDisc() with drawing them a pixel or a vertical line for each
+ octant step (the previous implementation), for radius 8 and 30, for a
+ vertical_top_lsb buffer (SSD1306) and a horizontal_right_lsb buffer
+ (ST7920)
+
+ No display is required.
+
+ Usage: ex_bench_circle [draws_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// The previous implementation: the 8 mirrored points, or the vertical
+// lines below them, for each step of the octant
+static void octant_steps(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0,
+                         u8g2_uint_t rad, uint8_t option, int is_disc)
+{
+  int f = 1 - rad;
+  int ddF_x = 1;
+  int ddF_y = -2 * rad;
+  int x = 0;
+  int y = rad;
+  for (;;) {
+    const int sx[4] = {1, -1, 1, -1};
+    const int sy[4] = {-1, -1, 1, 1};
+    const uint8_t q[4] = {U8G2_DRAW_UPPER_RIGHT, U8G2_DRAW_UPPER_LEFT,
+                          U8G2_DRAW_LOWER_RIGHT, U8G2_DRAW_LOWER_LEFT};
+    for (int i = 0; i < 4; i++) {
+      if ((option & q[i]) == 0)
+        continue;
+      if (is_disc) {
+        u8g2_DrawVLine(u8g2, x0 + sx[i] * x, sy[i] < 0 ? y0 - y : y0, y + 1);
+        u8g2_DrawVLine(u8g2, x0 + sx[i] * y, sy[i] < 0 ? y0 - x : y0, x + 1);
+      }
+      else {
+        u8g2_DrawPixel(u8g2, x0 + sx[i] * x, y0 + sy[i] * y);
+        u8g2_DrawPixel(u8g2, x0 + sx[i] * y, y0 + sy[i] * x);
+      }
+    }
+    if (x >= y)
+      break;
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+  }
+}
+
+// 0: previous circle, 1: u8g2_DrawCircle(), 2: previous disc,
+// 3: u8g2_DrawDisc()
+static void draw_shape(u8g2_t *u8g2, int method, u8g2_uint_t x0,
+                       u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
+{
+  switch (method) {
+  case 0:
+  case 2:
+    octant_steps(u8g2, x0, y0, rad, option, method == 2);
+    break;
+  case 1:
+    u8g2_DrawCircle(u8g2, x0, y0, rad, option);
+    break;
+  default:
+    u8g2_DrawDisc(u8g2, x0, y0, rad, option);
+    break;
+  }
+}
+
+// Draw the shape at positions across the display, and return draws per
+// second
+static double test_draws(u8g2_t *u8g2, int method, u8g2_uint_t rad,
+                         long draws)
+{
+  u8g2_uint_t width = u8g2_GetDisplayWidth(u8g2);
+  u8g2_uint_t height = u8g2_GetDisplayHeight(u8g2);
+  double start = now_secs();
+  for (long i = 0; i < draws; i++)
+    draw_shape(u8g2, method, (i * 7) % width, (i * 5) % height, rad,
+               U8G2_DRAW_ALL);
+  return draws / (now_secs() - start);
+}
+
+// Check that the two procedures set the same pixels
+static void check_same(u8g2_t *u8g2, int method)
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  u8g2_SetDrawColor(u8g2, 1);
+  for (int pass = 0; pass < 2; pass++) {
+    srand(1);
+    memset(u8g2->tile_buf_ptr, 0, buf_size);
+    for (int i = 0; i < 500; i++) {
+      u8g2_uint_t x0 = rand() % 160 - 16;
+      u8g2_uint_t y0 = rand() % 100 - 16;
+      u8g2_uint_t rad = rand() % 40;
+      uint8_t option = rand() % 16;
+      draw_shape(u8g2, method + pass, x0, y0, rad, option);
+    }
+    if (pass == 0)
+      memcpy(ref, u8g2->tile_buf_ptr, buf_size);
+    else if (memcmp(ref, u8g2->tile_buf_ptr, buf_size) != 0) {
+      fprintf(stderr, "buffers differ\n");
+      exit(1);
+    }
+  }
+  free(ref);
+}
+
+int main(int argc, char *argv[])
+{
+  long draws = (argc > 1) ? atol(argv[1]) : 100000;
+
+  const char *buffer_names[] = {"vertical", "horizontal"};
+  const char *shape_names[] = {"circle", "disc"};
+  const u8g2_uint_t radii[] = {8, 30};
+  printf("%-10s %-6s %3s %16s %16s %8s\n", "buffer", "shape", "rad",
+         "steps draws/s", "u8g2 draws/s", "speedup");
+  for (int buf = 0; buf < 2; buf++) {
+    u8g2_t u8g2;
+    if (buf == 0)
+      u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                         u8x8_dummy_cb);
+    else
+      u8g2_Setup_st7920_s_128x64_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                   u8x8_dummy_cb);
+    for (int shape = 0; shape < 2; shape++) {
+      check_same(&u8g2, shape * 2);
+      for (int i = 0; i < 2; i++) {
+        double a = test_draws(&u8g2, shape * 2, radii[i], draws);
+        double b = test_draws(&u8g2, shape * 2 + 1, radii[i], draws);
+        printf("%-10s %-6s %3d %16.0f %16.0f %7.2fx\n", buffer_names[buf],
+               shape_names[shape], radii[i], a, b, b / a);
+      }
+    }
+  }
+
+  return 0;
+}
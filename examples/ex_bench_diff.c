@@ -0,0 +1,110 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example measuring the cost of comparing frames with the
+ shadow buffer against the hardware I2C time saved by sending only the
+ tiles that differ
+
+ Each frame is cleared and redrawn in full, as a dashboard with a fixed
+ layout, a counter and a moving bar. The frames are sent without a bus
+ (u8x8_byte_empty), to measure the cost of the comparison, and then to
+ an SSD1306 on hardware I2C.
+
+ An SSD1306 (or another device answering at 0x3c) is required on an
+ adapter that supports plain I2C transfers. The i2c-stub module cannot be
+ used, as it only supports SMBus transfers, so every write would fail.
+ The example stops at the first failed transfer.
+
+ Usage: ex_bench_diff [bus_number [frames]]
+*/
+
+#include <libu8g2arm/u8g2.h>
+#include <libu8g2arm/u8g2arm.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void draw_frame(u8g2_t *u8g2, int i)
+{
+  char buf[16];
+  u8g2_ClearBuffer(u8g2);
+  u8g2_DrawFrame(u8g2, 0, 0, 128, 64);
+  u8g2_DrawStr(u8g2, 4, 12, "Pressure");
+  u8g2_DrawStr(u8g2, 4, 40, "Flow");
+  snprintf(buf, sizeof(buf), "%5d", i);
+  u8g2_DrawStr(u8g2, 80, 12, buf);
+  u8g2_DrawBox(u8g2, 40, 32, 8 + i % 80, 8);
+}
+
+// Draw and send the frames with u8g2_SendBuffer() or u8g2_SendDiff()
+static double send_frames(u8g2_t *u8g2, int frames, int use_diff)
+{
+  static uint8_t shadow[1024];
+  u8g2_SetShadowBuffer(u8g2, use_diff ? shadow : NULL);
+  double start = now_secs();
+  for (int i = 0; i < frames; i++) {
+    draw_frame(u8g2, i);
+    u8g2_SendDiff(u8g2);  // same as u8g2_SendBuffer() with no shadow buffer
+    // always succeeds for the display without a bus
+    if (!u8g2arm_arm_flush(u8g2_GetU8x8(u8g2))) {
+      fprintf(stderr, "I2C transfer failed\n");
+      exit(1);
+    }
+  }
+  return now_secs() - start;
+}
+
+static void print_times(const char *bus_name, u8g2_t *u8g2, int frames)
+{
+  const char *names[] = {"full", "diff"};
+  for (int use_diff = 0; use_diff < 2; use_diff++) {
+    double secs = send_frames(u8g2, frames, use_diff);
+    printf("%-7s %-5s %8.3f s  %10.1f us/frame  %8.1f frames/s\n", bus_name,
+           names[use_diff], secs, secs * 1e6 / frames, frames / secs);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int bus_number = (argc > 1) ? atoi(argv[1]) : 1;
+  int frames = (argc > 2) ? atoi(argv[2]) : 200;
+
+  u8g2_t u8g2;
+  u8x8_t *p_u8x8 = u8g2_GetU8x8(&u8g2);
+
+  // Without a bus, the times are drawing plus comparing (or not)
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                         u8x8_dummy_cb);
+  u8g2_SetFont(&u8g2, u8g2_font_6x10_tf);
+  printf("%d frames\n", frames);
+  print_times("no bus", &u8g2, frames * 10);
+
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0,
+                                         u8x8_byte_arm_linux_hw_i2c,
+                                         u8x8_arm_linux_gpio_and_delay);
+  if (!u8g2arm_arm_init_hw_i2c(p_u8x8, bus_number)) {
+    fprintf(stderr, "could not initialise I2C device\n");
+    exit(1);
+  }
+  u8g2arm_arm_use_linux_i2c_cad(p_u8x8);
+  u8g2_InitDisplay(&u8g2);
+  if (!u8g2arm_arm_flush(p_u8x8)) {
+    fprintf(stderr, "I2C transfer failed\n");
+    exit(1);
+  }
+  u8g2_SetFont(&u8g2, u8g2_font_6x10_tf);
+  char bus_name[16];
+  snprintf(bus_name, sizeof(bus_name), "i2c-%d", bus_number);
+  print_times(bus_name, &u8g2, frames);
+  u8g2arm_arm_free(p_u8x8);
+
+  return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of the U8G2 pixel, line and box
+ procedures with U8G2Fast, which has the buffer layout and the rotation
+ as template parameters, for U8G2_R0 and U8G2_R1, for a vertical_top_lsb
+ buffer (SSD1306) and a horizontal_right_lsb buffer (ST7920)
+
+ No display is required.
+
+ Usage: ex_bench_fast [draws_per_test]
+*/
+
+#include <libu8g2arm/U8g2Fast.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+static double now_secs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(U8G2 &u8g2)
+{
+  return u8g2.getBufferTileWidth() * 8 * u8g2.getBufferTileHeight();
+}
+
+// Draw with shape 0: pixels, 1: horizontal lines, 2: vertical lines,
+// 3: boxes, with the U8G2 procedures or with U8G2Fast
+template <class FAST>
+static void draw_shape(U8G2 &u8g2, FAST *fast, int shape, u8g2_uint_t x,
+                       u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  switch (shape) {
+  case 0:
+    if (fast)
+      fast->drawPixel(x, y);
+    else
+      u8g2.drawPixel(x, y);
+    break;
+  case 1:
+    if (fast)
+      fast->drawHLine(x, y, w);
+    else
+      u8g2.drawHLine(x, y, w);
+    break;
+  case 2:
+    if (fast)
+      fast->drawVLine(x, y, h);
+    else
+      u8g2.drawVLine(x, y, h);
+    break;
+  default:
+    if (fast)
+      fast->drawBox(x, y, w, h);
+    else
+      u8g2.drawBox(x, y, w, h);
+    break;
+  }
+}
+
+// Draw the shape at positions across the display with each draw colour,
+// and return draws per second
+template <class FAST>
+static double test_draws(U8G2 &u8g2, FAST *fast, int shape, long draws)
+{
+  u8g2_uint_t width = u8g2.getDisplayWidth();
+  u8g2_uint_t height = u8g2.getDisplayHeight();
+  double start = now_secs();
+  for (long i = 0; i < draws; i++) {
+    u8g2.setDrawColor(i % 3);
+    draw_shape(u8g2, fast, shape, (i * 7) % width, (i * 5) % height, 24, 12);
+  }
+  return draws / (now_secs() - start);
+}
+
+// Check that both give the same buffer, including shapes which are
+// partly outside the display
+template <class FAST>
+static void check_same(U8G2 &u8g2, FAST &fast)
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  for (int pass = 0; pass < 2; pass++) {
+    srand(1);
+    memset(u8g2.getBufferPtr(), 0x5a, buf_size);
+    for (int i = 0; i < 5000; i++) {
+      int shape = rand() % 4;
+      u8g2_uint_t x = rand() % 160 - 16;
+      u8g2_uint_t y = rand() % 160 - 16;
+      u8g2_uint_t w = rand() % 64;
+      u8g2_uint_t h = rand() % 64;
+      u8g2.setDrawColor(rand() % 3);
+      draw_shape(u8g2, pass == 0 ? (FAST *)nullptr : &fast, shape, x, y, w, h);
+    }
+    if (pass == 0)
+      memcpy(ref, u8g2.getBufferPtr(), buf_size);
+    else if (memcmp(ref, u8g2.getBufferPtr(), buf_size) != 0) {
+      fprintf(stderr, "buffers differ\n");
+      exit(1);
+    }
+  }
+  free(ref);
+}
+
+template <U8G2FastLayout layout, U8G2FastRotation rotation>
+static void test(const char *buffer_name, const u8g2_cb_t *cb, int rot,
+                 long draws)
+{
+  U8G2 u8g2;
+  if (layout == U8G2FastLayout::VerticalTopLsb)
+    u8g2_Setup_ssd1306_128x64_noname_f(u8g2.getU8g2(), cb, u8x8_byte_empty,
+                                       u8x8_dummy_cb);
+  else
+    u8g2_Setup_st7920_s_128x64_f(u8g2.getU8g2(), cb, u8x8_byte_empty,
+                                 u8x8_dummy_cb);
+  U8G2Fast<layout, rotation> fast(u8g2);
+  check_same(u8g2, fast);
+
+  const char *shape_names[] = {"pixel", "hline", "vline", "box"};
+  for (int shape = 0; shape < 4; shape++) {
+    double a = test_draws(u8g2, (U8G2Fast<layout, rotation> *)nullptr, shape,
+                          draws);
+    double b = test_draws(u8g2, &fast, shape, draws);
+    printf("%-10s %3d %-6s %15.0f %15.0f %7.2fx\n", buffer_name, rot,
+           shape_names[shape], a, b, b / a);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  long draws = (argc > 1) ? atol(argv[1]) : 2000000;
+
+  printf("%-10s %3s %-6s %15s %15s %8s\n", "buffer", "rot", "shape",
+         "U8G2 draws/s", "fast draws/s", "speedup");
+  test<U8G2FastLayout::VerticalTopLsb, U8G2FastRotation::R0>(
+      "vertical", U8G2_R0, 0, draws);
+  test<U8G2FastLayout::VerticalTopLsb, U8G2FastRotation::R1>(
+      "vertical", U8G2_R1, 90, draws);
+  test<U8G2FastLayout::HorizontalRightLsb, U8G2FastRotation::R0>(
+      "horizontal", U8G2_R0, 0, draws);
+  test<U8G2FastLayout::HorizontalRightLsb, U8G2FastRotation::R1>(
+      "horizontal", U8G2_R1, 90, draws);
+
+  return 0;
+}
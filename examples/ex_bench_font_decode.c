@@ -0,0 +1,194 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example checking and timing the font decoder. Every glyph of
+ every font in the library is drawn with u8g2_DrawGlyph() in each font
+ direction and compared with the glyph drawn a pixel at a time from the
+ runs read with u8g2_font_decode_get_unsigned_bits(), then the ASCII
+ glyphs of a few fonts are drawn for timing. Build the library with
+ -DU8G2_WITHOUT_FAST_FONT_DECODE to time the byte at a time decoder.
+
+ The font list, ex_bench_font_decode_fonts.h, is made by the Makefile
+ from the fonts defined in the installed libraries.
+
+ No display is required.
+
+ Usage: ex_bench_font_decode [glyphs_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// FONT(name) for each font in the libraries
+#define FONT(name) extern const uint8_t name[];
+#include "ex_bench_font_decode_fonts.h"
+#undef FONT
+
+static const struct {
+  const uint8_t *font;
+  const char *name;
+} all_fonts[] = {
+#define FONT(name) {name, #name},
+#include "ex_bench_font_decode_fonts.h"
+#undef FONT
+};
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// Draw the glyph a pixel at a time, reading the runs with the bit
+// reader of the byte at a time decoder and placing each pixel as
+// u8g2_font_decode_len() does
+static void draw_reference_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
+                                 uint16_t encoding, uint8_t dir)
+{
+  const uint8_t *data = u8g2_font_get_glyph_data(u8g2, encoding);
+  u8g2_glyph_header_t header;
+  u8g2_font_decode_t decode;
+  uint8_t px = 0, py = 0;
+
+  if (data == NULL)
+    return;
+  u8g2_font_read_glyph_header(u8g2, &decode, data, &header);
+  if (header.w == 0)
+    return;
+
+  u8g2_uint_t ox = u8g2_add_vector_x(x, header.x, -(header.h + header.y), dir);
+  u8g2_uint_t oy = u8g2_add_vector_y(y, header.x, -(header.h + header.y), dir);
+  while (py < header.h) {
+    uint8_t len[2];
+    len[0] = u8g2_font_decode_get_unsigned_bits(&decode,
+                                                u8g2->font_info.bits_per_0);
+    len[1] = u8g2_font_decode_get_unsigned_bits(&decode,
+                                                u8g2->font_info.bits_per_1);
+    do {
+      for (int fg = 0; fg < 2; fg++) {
+        for (uint8_t i = 0; i < len[fg]; i++) {
+          if (fg)
+            u8g2_DrawPixel(u8g2,
+                           u8g2_add_vector_x(ox, (int8_t)px, (int8_t)py, dir),
+                           u8g2_add_vector_y(oy, (int8_t)px, (int8_t)py, dir));
+          if (++px >= header.w) {
+            px = 0;
+            py++;
+          }
+        }
+      }
+    } while (u8g2_font_decode_get_unsigned_bits(&decode, 1) != 0);
+  }
+}
+
+// Draw the glyph with u8g2_DrawGlyph() and then XOR the reference glyph
+// over it, and return 0 if any pixel is left set. The buffer is clear
+// again when the glyphs match.
+static int check_glyph(u8g2_t *u8g2, uint16_t encoding, uint8_t dir)
+{
+  const uint8_t *buf = u8g2->tile_buf_ptr;
+  size_t buf_size = buffer_size(u8g2);
+  u8g2_uint_t x = u8g2_GetDisplayWidth(u8g2) / 2;
+  u8g2_uint_t y = u8g2_GetDisplayHeight(u8g2) / 2;
+
+  u8g2_SetDrawColor(u8g2, 1);
+  u8g2_DrawGlyph(u8g2, x, y, encoding);
+  u8g2_SetDrawColor(u8g2, 2);
+  draw_reference_glyph(u8g2, x, y, encoding, dir);
+  u8g2_SetDrawColor(u8g2, 1);
+
+  for (size_t i = 0; i < buf_size; i++)
+    if (buf[i] != 0)
+      return 0;
+  return 1;
+}
+
+// Check every glyph of the font in each direction, return glyphs checked
+static long check_font(u8g2_t *u8g2, const char *font_name)
+{
+  static uint16_t glyphs[0x10000];
+  long len = 0;
+  for (uint32_t e = 0; e < 0x10000; e++)
+    if (u8g2_IsGlyph(u8g2, e))
+      glyphs[len++] = e;
+
+  u8g2_SetFontMode(u8g2, 1);
+  for (uint8_t dir = 0; dir < 4; dir++) {
+    u8g2_SetFontDirection(u8g2, dir);
+    for (long i = 0; i < len; i++) {
+      if (!check_glyph(u8g2, glyphs[i], dir)) {
+        fprintf(stderr, "%s: glyph %u differs in direction %u\n", font_name,
+                glyphs[i], dir);
+        exit(1);
+      }
+    }
+  }
+  u8g2_SetFontDirection(u8g2, 0);
+  u8g2_SetFontMode(u8g2, 0);
+  return len * 4;
+}
+
+// Draw the printable ASCII glyphs one after another, return glyphs per
+// second
+static double test_glyphs(u8g2_t *u8g2, long cnt)
+{
+  uint16_t glyphs[95];
+  int len = 0;
+  for (uint16_t c = 32; c < 127; c++)
+    if (u8g2_IsGlyph(u8g2, c))
+      glyphs[len++] = c;
+  if (len == 0)
+    return 0;
+
+  double start = now_secs();
+  for (long i = 0; i < cnt; i++)
+    u8g2_DrawGlyph(u8g2, (i * 7) % 64, 50, glyphs[i % len]);
+  return cnt / (now_secs() - start);
+}
+
+int main(int argc, char *argv[])
+{
+  long cnt = (argc > 1) ? atol(argv[1]) : 500000;
+
+  const uint8_t *fonts[] = {u8g2_font_5x7_tf,          u8g2_font_6x10_tf,
+                            u8g2_font_helvB12_tf,      u8g2_font_ncenB24_tf,
+                            u8g2_font_logisoso32_tf,   u8g2_font_inr38_mf,
+                            u8g2_font_b10_t_japanese1,
+                            u8g2_font_open_iconic_all_4x_t};
+  const char *font_names[] = {"5x7_tf",        "6x10_tf",
+                              "helvB12_tf",    "ncenB24_tf",
+                              "logisoso32_tf", "inr38_mf",
+                              "b10_t_japanese1", "open_iconic_all_4x_t"};
+  const int num_fonts = sizeof(fonts) / sizeof(fonts[0]);
+  const int num_all_fonts = sizeof(all_fonts) / sizeof(all_fonts[0]);
+
+  // The largest full buffer, with the glyphs drawn at its centre
+  u8g2_t u8g2;
+  u8g2_Setup_ls027b7dh01_400x240_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                   u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+
+  long checked = 0;
+  for (int f = 0; f < num_all_fonts; f++) {
+    u8g2_SetFont(&u8g2, all_fonts[f].font);
+    checked += check_font(&u8g2, all_fonts[f].name);
+  }
+  printf("checked %ld glyphs of %d fonts\n\n", checked, num_all_fonts);
+
+  printf("%-22s %14s\n", "font", "glyphs/s");
+  for (int f = 0; f < num_fonts; f++) {
+    u8g2_SetFont(&u8g2, fonts[f]);
+    printf("%-22s %14.0f\n", font_names[f], test_glyphs(&u8g2, cnt));
+  }
+
+  return 0;
+}
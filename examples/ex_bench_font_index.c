@@ -0,0 +1,167 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_DrawUTF8(),
+ u8g2_GetUTF8Width() and u8g2_IsGlyph() with and without a font index
+ cache, for strings of Japanese kanji and kana, and of ASCII characters
+
+ No display is required.
+
+ Usage: ex_bench_font_index [strings_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STRINGS 16
+#define CHARS 12
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+static char *put_utf8(char *s, uint16_t e)
+{
+  if (e < 0x80) {
+    *s++ = e;
+  }
+  else if (e < 0x800) {
+    *s++ = 0xc0 | (e >> 6);
+    *s++ = 0x80 | (e & 0x3f);
+  }
+  else {
+    *s++ = 0xe0 | (e >> 12);
+    *s++ = 0x80 | ((e >> 6) & 0x3f);
+    *s++ = 0x80 | (e & 0x3f);
+  }
+  return s;
+}
+
+// Make strings of random glyphs of the font between first and last
+static void make_strings(u8g2_t *u8g2, uint16_t first, uint16_t last,
+                         char strings[STRINGS][CHARS * 3 + 1])
+{
+  static uint16_t glyphs[65536];
+  int cnt = 0;
+  for (uint32_t e = first; e <= last; e++)
+    if (u8g2_IsGlyph(u8g2, e))
+      glyphs[cnt++] = e;
+  srand(1);
+  for (int i = 0; i < STRINGS; i++) {
+    char *s = strings[i];
+    for (int j = 0; j < CHARS; j++)
+      s = put_utf8(s, glyphs[rand() % cnt]);
+    *s = '\0';
+  }
+}
+
+// 0: u8g2_DrawUTF8(), 1: u8g2_GetUTF8Width(), 2: u8g2_IsGlyph() for each
+// character, return strings per second
+static double test_strings(u8g2_t *u8g2, int method,
+                           char strings[STRINGS][CHARS * 3 + 1], long cnt)
+{
+  u8g2_uint_t width = u8g2_GetDisplayWidth(u8g2);
+  u8g2_uint_t height = u8g2_GetDisplayHeight(u8g2);
+  volatile unsigned sum = 0;
+  double start = now_secs();
+  for (long i = 0; i < cnt; i++) {
+    const char *s = strings[i % STRINGS];
+    if (method == 0) {
+      u8g2_DrawUTF8(u8g2, (i * 7) % width, (i * 5) % height, s);
+    }
+    else if (method == 1) {
+      sum += u8g2_GetUTF8Width(u8g2, s);
+    }
+    else {
+      u8x8_utf8_init(u8g2_GetU8x8(u8g2));
+      for (; *s != '\0'; s++) {
+        uint16_t e = u8x8_utf8_next(u8g2_GetU8x8(u8g2), (uint8_t)*s);
+        if (e < 0x0fffe)
+          sum += u8g2_IsGlyph(u8g2, e);
+      }
+    }
+  }
+  return cnt / (now_secs() - start);
+}
+
+// Check that the strings are drawn the same with the index
+static void check_same(u8g2_t *u8g2, u8g2_font_index_cache_t *cache,
+                       char strings[STRINGS][CHARS * 3 + 1])
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  for (int pass = 0; pass < 2; pass++) {
+    u8g2_SetFontIndexCache(u8g2, pass == 0 ? NULL : cache);
+    memset(u8g2->tile_buf_ptr, 0, buf_size);
+    for (int i = 0; i < STRINGS; i++)
+      u8g2_DrawUTF8(u8g2, i * 3, i * 4 + 10, strings[i]);
+    if (pass == 0)
+      memcpy(ref, u8g2->tile_buf_ptr, buf_size);
+    else if (memcmp(ref, u8g2->tile_buf_ptr, buf_size) != 0) {
+      fprintf(stderr, "buffers differ\n");
+      exit(1);
+    }
+  }
+  u8g2_SetFontIndexCache(u8g2, NULL);
+  free(ref);
+}
+
+int main(int argc, char *argv[])
+{
+  long cnt = (argc > 1) ? atol(argv[1]) : 200000;
+
+  const uint8_t *fonts[] = {u8g2_font_b10_t_japanese1, u8g2_font_6x10_tf};
+  const char *font_names[] = {"b10_t_japanese1", "6x10_tf"};
+  const uint16_t first[] = {0x3000, 0x20};
+  const uint16_t last[] = {0x9fff, 0x7e};
+  const char *method_names[] = {"DrawUTF8", "GetUTF8Width", "IsGlyph"};
+
+  u8g2_t u8g2;
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                     u8x8_dummy_cb);
+
+  // One index for each font, with room for the glyphs above 255
+  uint32_t slot_size = 0;
+  for (int f = 0; f < 2; f++)
+    if (u8g2_GetFontIndexSize(fonts[f]) > slot_size)
+      slot_size = u8g2_GetFontIndexSize(fonts[f]);
+  static u8g2_font_index_t indexes[2];
+  uint32_t *data = (uint32_t *)malloc(2 * slot_size * sizeof(uint32_t));
+  u8g2_font_index_cache_t cache;
+  u8g2_InitFontIndexCache(&cache, indexes, 2, data, slot_size);
+
+  printf("%-16s %-13s %16s %16s %8s\n", "font", "procedure",
+         "search str/s", "index str/s", "speedup");
+  for (int f = 0; f < 2; f++) {
+    static char strings[STRINGS][CHARS * 3 + 1];
+    u8g2_SetFont(&u8g2, fonts[f]);
+    make_strings(&u8g2, first[f], last[f], strings);
+    check_same(&u8g2, &cache, strings);
+    for (int m = 0; m < 3; m++) {
+      u8g2_SetFontIndexCache(&u8g2, NULL);
+      double a = test_strings(&u8g2, m, strings, cnt);
+      u8g2_SetFontIndexCache(&u8g2, &cache);
+      double b = test_strings(&u8g2, m, strings, cnt);
+      printf("%-16s %-13s %16.0f %16.0f %7.2fx\n", font_names[f],
+             method_names[m], a, b, b / a);
+    }
+    u8g2_SetFontIndexCache(&u8g2, NULL);
+  }
+  printf("index cache hits %u misses %u\n", (unsigned)cache.hits,
+         (unsigned)cache.misses);
+
+  free(data);
+  return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_GetUTF8Width() without
+ caches, with a font metrics cache, and with a font metrics cache and a
+ string width cache, for the labels of a menu which are centered twice
+ per frame, in two ASCII fonts and a Japanese font
+
+ No display is required.
+
+ Usage: ex_bench_font_metrics [frames_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LABELS 8
+#define TABLES 2
+#define ENTRIES 32
+#define SLOT_SIZE 32
+
+static const char *ascii_labels[LABELS] = {
+    "Settings", "Brightness", "Contrast", "Sleep after", "Network",
+    "Firmware update", "About", "Back"};
+static const char *japanese_labels[LABELS] = {
+    "設定", "明るさ", "コントラスト", "スリープ", "ネットワーク",
+    "ファームウェア", "情報", "もどる"};
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Measure each label twice, as a layout pass and a draw pass would, and
+// return frames per second
+static double test_frames(u8g2_t *u8g2, const char **labels, long cnt,
+                          unsigned *sum)
+{
+  u8g2_uint_t display_width = u8g2_GetDisplayWidth(u8g2);
+  double start = now_secs();
+  *sum = 0;
+  for (long i = 0; i < cnt; i++) {
+    for (int pass = 0; pass < 2; pass++)
+      for (int j = 0; j < LABELS; j++)
+        *sum += (display_width - u8g2_GetUTF8Width(u8g2, labels[j])) / 2;
+  }
+  return cnt / (now_secs() - start);
+}
+
+int main(int argc, char *argv[])
+{
+  long cnt = (argc > 1) ? atol(argv[1]) : 100000;
+
+  const uint8_t *fonts[] = {u8g2_font_6x10_tf, u8g2_font_helvB12_tr,
+                            u8g2_font_b10_t_japanese1};
+  const char *font_names[] = {"6x10_tf", "helvB12_tr", "b10_t_japanese1"};
+  const char **labels[] = {ascii_labels, ascii_labels, japanese_labels};
+
+  static u8g2_font_metrics_t tables[TABLES];
+  u8g2_font_metrics_cache_t metrics_cache;
+  u8g2_InitFontMetricsCache(&metrics_cache, tables, TABLES);
+
+  static u8g2_str_width_entry_t entries[ENTRIES];
+  static char data[ENTRIES * SLOT_SIZE];
+  u8g2_str_width_cache_t str_cache;
+  u8g2_InitStrWidthCache(&str_cache, entries, ENTRIES, data, SLOT_SIZE);
+
+  u8g2_t u8g2;
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                     u8x8_dummy_cb);
+
+  printf("%-16s %14s %14s %14s %8s %8s\n", "font", "none frame/s",
+         "glyphs frame/s", "strings frame/s", "glyphs", "strings");
+  for (int f = 0; f < 3; f++) {
+    unsigned sum[3];
+    u8g2_SetFont(&u8g2, fonts[f]);
+
+    u8g2_SetFontMetricsCache(&u8g2, NULL);
+    u8g2_SetStrWidthCache(&u8g2, NULL);
+    double a = test_frames(&u8g2, labels[f], cnt, &sum[0]);
+    u8g2_SetFontMetricsCache(&u8g2, &metrics_cache);
+    double b = test_frames(&u8g2, labels[f], cnt, &sum[1]);
+    u8g2_SetStrWidthCache(&u8g2, &str_cache);
+    double c = test_frames(&u8g2, labels[f], cnt, &sum[2]);
+    u8g2_SetFontMetricsCache(&u8g2, NULL);
+    u8g2_SetStrWidthCache(&u8g2, NULL);
+
+    if (sum[1] != sum[0] || sum[2] != sum[0]) {
+      fprintf(stderr, "widths differ\n");
+      return 1;
+    }
+    printf("%-16s %14.0f %14.0f %15.0f %7.2fx %7.2fx\n", font_names[f], a, b,
+           c, b / a, c / a);
+  }
+  printf("font metrics hits %u misses %u, string widths hits %u misses %u\n",
+         (unsigned)metrics_cache.hits, (unsigned)metrics_cache.misses,
+         (unsigned)str_cache.hits, (unsigned)str_cache.misses);
+
+  return 0;
+}
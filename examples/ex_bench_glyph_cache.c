@@ -0,0 +1,124 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_DrawStr() with and
+ without a glyph cache, for changing numbers and fixed labels in a small,
+ a medium and a large font, for a vertical_top_lsb buffer (SSD1306) and
+ a horizontal_right_lsb buffer (ST7920)
+
+ No display is required.
+
+ Usage: ex_bench_glyph_cache [strings_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ENTRIES 128
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// Draw a label and a number, as a screen which is updated every frame,
+// and return strings per second
+static double test_strings(u8g2_t *u8g2, long cnt)
+{
+  const char *labels[] = {"Temp", "Volt", "Speed", "Level"};
+  char number[16];
+  double start = now_secs();
+  for (long i = 0; i < cnt; i += 2) {
+    snprintf(number, sizeof(number), "%ld.%ld", (i / 2) % 1000, i % 10);
+    u8g2_DrawStr(u8g2, 0, 40, labels[i % 4]);
+    u8g2_DrawStr(u8g2, 60, 40, number);
+  }
+  return cnt / (now_secs() - start);
+}
+
+// Check that the glyph cache draws the same, in each font direction and
+// mode, with each draw colour and partly outside the display
+static void check_same(u8g2_t *u8g2, u8g2_glyph_cache_t *cache)
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  for (int pass = 0; pass < 2; pass++) {
+    srand(1);
+    memset(u8g2->tile_buf_ptr, 0x5a, buf_size);
+    u8g2_SetGlyphCache(u8g2, pass == 0 ? NULL : cache);
+    for (int i = 0; i < 500; i++) {
+      char s[8];
+      snprintf(s, sizeof(s), "%d:A", rand() % 1000);
+      u8g2_SetFontDirection(u8g2, rand() % 4);
+      u8g2_SetFontMode(u8g2, rand() % 2);
+      u8g2_SetDrawColor(u8g2, rand() % 3);
+      u8g2_DrawStr(u8g2, rand() % 160 - 16, rand() % 100 - 16, s);
+    }
+    if (pass == 0)
+      memcpy(ref, u8g2->tile_buf_ptr, buf_size);
+    else if (memcmp(ref, u8g2->tile_buf_ptr, buf_size) != 0) {
+      fprintf(stderr, "buffers differ\n");
+      exit(1);
+    }
+  }
+  u8g2_SetGlyphCache(u8g2, NULL);
+  u8g2_SetFontDirection(u8g2, 0);
+  u8g2_SetFontMode(u8g2, 0);
+  u8g2_SetDrawColor(u8g2, 1);
+  free(ref);
+}
+
+int main(int argc, char *argv[])
+{
+  long cnt = (argc > 1) ? atol(argv[1]) : 200000;
+
+  const uint8_t *fonts[] = {u8g2_font_6x10_tf, u8g2_font_helvB12_tr,
+                            u8g2_font_logisoso32_tr};
+  const char *font_names[] = {"6x10_tf", "helvB12_tr", "logisoso32_tr"};
+  const char *buffer_names[] = {"vertical", "horizontal"};
+
+  static u8g2_glyph_cache_entry_t entries[ENTRIES];
+  u8g2_glyph_cache_t cache;
+
+  printf("%-10s %-14s %6s %14s %14s %8s\n", "buffer", "font", "slot",
+         "decode str/s", "cache str/s", "speedup");
+  for (int buf = 0; buf < 2; buf++) {
+    u8g2_t u8g2;
+    if (buf == 0)
+      u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                         u8x8_dummy_cb);
+    else
+      u8g2_Setup_st7920_s_128x64_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                   u8x8_dummy_cb);
+    for (int f = 0; f < 3; f++) {
+      u8g2_SetFont(&u8g2, fonts[f]);
+      uint32_t slot_size = u8g2_GetGlyphCacheSlotSize(&u8g2);
+      uint8_t *data = (uint8_t *)malloc(ENTRIES * slot_size);
+      u8g2_InitGlyphCache(&cache, entries, ENTRIES, data, slot_size);
+
+      check_same(&u8g2, &cache);
+      u8g2_ClearGlyphCache(&cache);
+      double a = test_strings(&u8g2, cnt);
+      u8g2_SetGlyphCache(&u8g2, &cache);
+      double b = test_strings(&u8g2, cnt);
+      u8g2_SetGlyphCache(&u8g2, NULL);
+      printf("%-10s %-14s %6u %14.0f %14.0f %7.2fx  hits %u misses %u\n",
+             buffer_names[buf], font_names[f], (unsigned)slot_size, a, b,
+             b / a, (unsigned)cache.hits, (unsigned)cache.misses);
+      free(data);
+    }
+  }
+
+  return 0;
+}
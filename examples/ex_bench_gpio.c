@@ -0,0 +1,65 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example measuring the latency of GPIO edges, as used by the
+ bit-banged protocols (software SPI and I2C, 8080)
+
+ No display is required, but the pins must be free to use as outputs,
+ and they will be toggled.
+
+ Usage: ex_bench_gpio [edges [pin0 pin1 ... pin7]]
+*/
+
+#include <libu8g2arm/gpio.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[])
+{
+  int edges = (argc > 1) ? atoi(argv[1]) : 100000;
+  int pins[8] = {5, 6, 12, 13, 16, 19, 20, 26};
+  int values[8];
+  for (int i = 0; i < 8 && i + 2 < argc; i++)
+    pins[i] = atoi(argv[i + 2]);
+
+  exportGPIOOutputs(pins, 8, GPIO_LOW);
+  printf("%d edges on GPIO%d, %d bytes on GPIO%d-GPIO%d\n", edges, pins[0],
+         edges, pins[0], pins[7]);
+
+  // one pin
+  double start = now_secs();
+  for (int n = 0; n < edges; n++)
+    setGPIOValue(pins[0], n & 1);
+  double secs = now_secs() - start;
+  printf("single pin          %8.0f ns/edge\n", secs * 1e9 / edges);
+
+  // eight pins, one call for each pin
+  start = now_secs();
+  for (int n = 0; n < edges; n++) {
+    for (int i = 0; i < 8; i++)
+      setGPIOValue(pins[i], (n >> i) & 1);
+  }
+  secs = now_secs() - start;
+  printf("8 pins, 8 calls     %8.0f ns/byte\n", secs * 1e9 / edges);
+
+  // eight pins, one call for all the pins
+  start = now_secs();
+  for (int n = 0; n < edges; n++) {
+    for (int i = 0; i < 8; i++)
+      values[i] = (n >> i) & 1;
+    setGPIOValues(pins, values, 8);
+  }
+  secs = now_secs() - start;
+  printf("8 pins, 1 call      %8.0f ns/byte\n", secs * 1e9 / edges);
+
+  return 0;
+}
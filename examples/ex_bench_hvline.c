@@ -0,0 +1,127 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the horizontal line drawing speed of the
+ vertical_top_lsb buffer (used by SSD13xx, ST7565 and similar) with a
+ byte at a time loop, for lines of 1 to 256 pixels
+
+ No display is required.
+
+ Usage: ex_bench_hvline [pixels_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// The horizontal line of u8g2_ll_hvline_vertical_top_lsb() drawn a byte
+// at a time, with a check on every byte
+static void hline_bytes(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
+                        u8g2_uint_t len, uint8_t dir)
+{
+  (void)dir;
+  uint8_t *max_ptr = u8g2->tile_buf_ptr + buffer_size(u8g2);
+  uint8_t mask = 1 << (y & 7);
+  uint8_t or_mask = (u8g2->draw_color <= 1) ? mask : 0;
+  uint8_t xor_mask = (u8g2->draw_color != 1) ? mask : 0;
+  uint8_t *ptr = u8g2->tile_buf_ptr +
+                 (y & ~7) * u8g2_GetBufferTileWidth(u8g2) + x;
+  do {
+    assert(ptr < max_ptr);
+    *ptr |= or_mask;
+    *ptr ^= xor_mask;
+    ptr++;
+    len--;
+  } while (len != 0);
+}
+
+// Draw lines of length len at each start column and row, with each draw
+// colour, until the pixel count is reached, and return pixels per second
+static double test_lines(u8g2_t *u8g2, u8g2_draw_ll_hvline_cb hline,
+                         u8g2_uint_t len, long pixels)
+{
+  u8g2_uint_t width = u8g2_GetBufferTileWidth(u8g2) * 8;
+  u8g2_uint_t height = u8g2_GetBufferTileHeight(u8g2) * 8;
+  long cnt = 0;
+  u8g2_uint_t x = 0, y = 0;
+  double start = now_secs();
+  while (cnt < pixels) {
+    u8g2->draw_color = cnt % 3;
+    hline(u8g2, x, y, len, 0);
+    cnt += len;
+    if (++x + len > width) {
+      x = 0;
+      y = (y + 1) % height;
+    }
+  }
+  return cnt / (now_secs() - start);
+}
+
+int main(int argc, char *argv[])
+{
+  long pixels = (argc > 1) ? atol(argv[1]) : 50000000;
+
+  // A 256x128 buffer, so that lines of up to 256 pixels can be drawn
+  u8g2_t u8g2;
+  u8g2_Setup_st75256_jlx256128_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                 u8x8_dummy_cb);
+  if (u8g2.ll_hvline != u8g2_ll_hvline_vertical_top_lsb) {
+    fprintf(stderr, "buffer does not use u8g2_ll_hvline_vertical_top_lsb\n");
+    exit(1);
+  }
+
+  // Check the two procedures give the same buffer
+  size_t buf_size = buffer_size(&u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  srand(1);
+  for (int pass = 0; pass < 2; pass++) {
+    memset(u8g2.tile_buf_ptr, 0x5a, buf_size);
+    for (int i = 0; i < 10000; i++) {
+      u8g2_uint_t len = 1 + rand() % 256;
+      u8g2_uint_t x = rand() % (257 - len);
+      u8g2_uint_t y = rand() % 128;
+      u8g2.draw_color = rand() % 3;
+      if (pass == 0)
+        hline_bytes(&u8g2, x, y, len, 0);
+      else
+        u8g2_ll_hvline_vertical_top_lsb(&u8g2, x, y, len, 0);
+    }
+    if (pass == 0)
+      memcpy(ref, u8g2.tile_buf_ptr, buf_size);
+    else if (memcmp(ref, u8g2.tile_buf_ptr, buf_size) != 0) {
+      fprintf(stderr, "buffers differ\n");
+      exit(1);
+    }
+    srand(1);
+  }
+  free(ref);
+
+  printf("%6s %16s %16s %8s\n", "length", "bytes pixels/s", "u8g2 pixels/s",
+         "speedup");
+  const int lens[] = {1,  2,  3,  4,  7,   8,   12,  16,  24,  31,
+                      32, 48, 64, 96, 100, 128, 160, 192, 255, 256};
+  for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+    double a = test_lines(&u8g2, hline_bytes, lens[i], pixels);
+    double b = test_lines(&u8g2, u8g2_ll_hvline_vertical_top_lsb, lens[i],
+                          pixels);
+    printf("%6d %16.0f %16.0f %7.2fx\n", lens[i], a, b, b / a);
+  }
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example measuring hardware I2C throughput of an SSD1306
+ with each CAD and transmit mode
+
+ An SSD1306 (or another device answering at 0x3c) is required on an
+ adapter that supports plain I2C transfers. The i2c-stub module cannot be
+ used, as it only supports SMBus transfers, so every write would fail.
+ The example stops at the first failed transfer.
+
+ Usage: ex_bench_i2c [bus_number [frames]]
+*/
+
+#include <libu8g2arm/u8g2.h>
+#include <libu8g2arm/u8g2arm.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double send_frames(u8g2_t *u8g2, int frames)
+{
+  double start = now_secs();
+  for (int i = 0; i < frames; i++) {
+    u8g2_SendBuffer(u8g2);
+    if (!u8g2arm_arm_flush(u8g2_GetU8x8(u8g2))) {
+      fprintf(stderr, "I2C transfer failed\n");
+      exit(1);
+    }
+  }
+  return now_secs() - start;
+}
+
+int main(int argc, char *argv[])
+{
+  int bus_number = (argc > 1) ? atoi(argv[1]) : 1;
+  int frames = (argc > 2) ? atoi(argv[2]) : 50;
+
+  u8g2_t u8g2;
+  u8x8_t *p_u8x8 = u8g2_GetU8x8(&u8g2);
+
+  // An SSD1306 128x64 sends 1024 data bytes (8 pages) per frame
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0,
+                                         u8x8_byte_arm_linux_hw_i2c,
+                                         u8x8_arm_linux_gpio_and_delay);
+  if (!u8g2arm_arm_init_hw_i2c(p_u8x8, bus_number)) {
+    fprintf(stderr, "could not initialise I2C device\n");
+    exit(1);
+  }
+  u8g2_InitDisplay(&u8g2);
+  if (!u8g2arm_arm_flush(p_u8x8)) {
+    fprintf(stderr, "I2C transfer failed\n");
+    exit(1);
+  }
+
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_DrawBox(&u8g2, 16, 8, 96, 48);
+
+  long frame_bytes = (long)u8g2_GetBufferTileWidth(&u8g2) * 8 *
+                     u8g2_GetBufferTileHeight(&u8g2);
+  printf("i2c-%d, %d frames of %ld bytes\n", bus_number, frames, frame_bytes);
+
+  u8x8_msg_cb default_cad = p_u8x8->cad_cb;
+  const char *cad_names[] = {"24 byte", "page"};
+  const char *mode_names[] = {"byte", "batch"};
+  int modes[] = {U8G2ARM_TX_BYTE, U8G2ARM_TX_BATCH};
+  for (int cad = 0; cad < 2; cad++) {
+    if (cad)
+      u8g2arm_arm_use_linux_i2c_cad(p_u8x8);
+    else
+      p_u8x8->cad_cb = default_cad;
+    for (int i = 0; i < 2; i++) {
+      u8g2arm_arm_set_tx_mode(p_u8x8, modes[i]);
+      double secs = send_frames(&u8g2, frames);
+      printf("%-7s %-6s %8.3f s  %8.0f bytes/s  %6.1f frames/s\n",
+             cad_names[cad], mode_names[i], secs, frames * frame_bytes / secs,
+             frames / secs);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_DrawLine() with drawing
+ the line a pixel at a time (the previous implementation), for random
+ lines, for 128x64 and 256x64 buffers in the vertical_top_lsb (SSD1306,
+ SSD1322) and horizontal_right_lsb (ST7920, T6963) layouts
+
+ No display is required.
+
+ Usage: ex_bench_line [draws_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LINES 1024
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// The previous implementation: Bresenham with u8g2_DrawPixel() for each
+// pixel
+static void line_pixels(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1,
+                        u8g2_uint_t x2, u8g2_uint_t y2)
+{
+  u8g2_uint_t tmp;
+  int swapxy = 0;
+  u8g2_uint_t dx = (x1 > x2) ? x1 - x2 : x2 - x1;
+  u8g2_uint_t dy = (y1 > y2) ? y1 - y2 : y2 - y1;
+  if (dy > dx) {
+    swapxy = 1;
+    tmp = dx; dx = dy; dy = tmp;
+    tmp = x1; x1 = y1; y1 = tmp;
+    tmp = x2; x2 = y2; y2 = tmp;
+  }
+  if (x1 > x2) {
+    tmp = x1; x1 = x2; x2 = tmp;
+    tmp = y1; y1 = y2; y2 = tmp;
+  }
+  int err = dx >> 1;
+  int ystep = (y2 > y1) ? 1 : -1;
+  u8g2_uint_t y = y1;
+  for (u8g2_uint_t x = x1; x <= x2; x++) {
+    if (swapxy == 0)
+      u8g2_DrawPixel(u8g2, x, y);
+    else
+      u8g2_DrawPixel(u8g2, y, x);
+    err -= dy;
+    if (err < 0) {
+      y += ystep;
+      err += dx;
+    }
+  }
+}
+
+typedef void (*draw_line_fn)(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1,
+                             u8g2_uint_t x2, u8g2_uint_t y2);
+
+// Draw the lines with each draw colour, and return lines per second
+static double test_draws(u8g2_t *u8g2, draw_line_fn draw,
+                         const u8g2_uint_t lines[][4], long draws)
+{
+  double start = now_secs();
+  for (long i = 0; i < draws; i++) {
+    const u8g2_uint_t *l = lines[i % LINES];
+    u8g2_SetDrawColor(u8g2, i % 3);
+    draw(u8g2, l[0], l[1], l[2], l[3]);
+  }
+  return draws / (now_secs() - start);
+}
+
+// Check that the two procedures give the same buffer, including lines
+// which are partly outside the display
+static void check_same(u8g2_t *u8g2)
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  u8g2_uint_t width = u8g2_GetDisplayWidth(u8g2);
+  u8g2_uint_t height = u8g2_GetDisplayHeight(u8g2);
+  for (int pass = 0; pass < 2; pass++) {
+    srand(1);
+    memset(u8g2->tile_buf_ptr, 0x5a, buf_size);
+    for (int i = 0; i < 5000; i++) {
+      u8g2_uint_t x1 = rand() % (width + 32);
+      u8g2_uint_t y1 = rand() % (height + 32);
+      u8g2_uint_t x2 = rand() % (width + 32);
+      u8g2_uint_t y2 = rand() % (height + 32);
+      u8g2_SetDrawColor(u8g2, rand() % 3);
+      if (pass == 0)
+        line_pixels(u8g2, x1, y1, x2, y2);
+      else
+        u8g2_DrawLine(u8g2, x1, y1, x2, y2);
+    }
+    if (pass == 0)
+      memcpy(ref, u8g2->tile_buf_ptr, buf_size);
+    else if (memcmp(ref, u8g2->tile_buf_ptr, buf_size) != 0) {
+      fprintf(stderr, "buffers differ\n");
+      exit(1);
+    }
+  }
+  free(ref);
+}
+
+int main(int argc, char *argv[])
+{
+  long draws = (argc > 1) ? atol(argv[1]) : 200000;
+
+  const char *buffer_names[] = {"vertical", "horizontal"};
+  printf("%-10s %7s %16s %16s %8s\n", "buffer", "size", "pixels lines/s",
+         "u8g2 lines/s", "speedup");
+  for (int size = 0; size < 2; size++) {
+    for (int buf = 0; buf < 2; buf++) {
+      u8g2_t u8g2;
+      if (size == 0 && buf == 0)
+        u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                           u8x8_dummy_cb);
+      else if (size == 0)
+        u8g2_Setup_st7920_s_128x64_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                     u8x8_dummy_cb);
+      else if (buf == 0)
+        u8g2_Setup_ssd1322_nhd_256x64_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                        u8x8_dummy_cb);
+      else
+        u8g2_Setup_t6963_256x64_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                  u8x8_dummy_cb);
+      check_same(&u8g2);
+
+      // Random lines inside the display
+      static u8g2_uint_t lines[LINES][4];
+      u8g2_uint_t width = u8g2_GetDisplayWidth(&u8g2);
+      u8g2_uint_t height = u8g2_GetDisplayHeight(&u8g2);
+      srand(2);
+      for (int i = 0; i < LINES; i++) {
+        lines[i][0] = rand() % width;
+        lines[i][1] = rand() % height;
+        lines[i][2] = rand() % width;
+        lines[i][3] = rand() % height;
+      }
+
+      double a = test_draws(&u8g2, line_pixels, lines, draws);
+      double b = test_draws(&u8g2, u8g2_DrawLine, lines, draws);
+      char name[16];
+      snprintf(name, sizeof(name), "%dx%d", width, height);
+      printf("%-10s %7s %16.0f %16.0f %7.2fx\n", buffer_names[buf], name, a,
+             b, b / a);
+    }
+  }
+
+  return 0;
+}
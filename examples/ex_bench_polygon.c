@@ -0,0 +1,238 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example checking and timing the polygon fill. Concave,
+ self-intersecting and random polygons, some with vertices far outside
+ the display (up to +-30000), are filled with u8g2_FillPolygon() with
+ the even-odd and the non-zero rule, and compared with a reference that
+ tests the center of every pixel of the display against each edge. This
+ is done for a vertical_top_lsb buffer (SSD1306) and a
+ horizontal_right_lsb buffer (ST7920), with and without a clip window.
+ Then the speed of u8g2_FillPolygon() is compared with the global
+ polygon of u8g2_DrawPolygon().
+
+ No display is required.
+
+ Usage: ex_bench_polygon [draws_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_VERTICES 48
+#define NUM_RANDOM 1000
+
+typedef struct {
+  const char *name;
+  int cnt;
+  int16_t x[MAX_VERTICES];
+  int16_t y[MAX_VERTICES];
+} shape_t;
+
+static const shape_t fixed_shapes[] = {
+    {"arrow", 7, {10, 60, 60, 100, 60, 60, 10}, {25, 25, 5, 32, 59, 40, 40}},
+    {"comb",
+     10,
+     {5, 120, 120, 100, 90, 70, 60, 40, 30, 5},
+     {5, 5, 60, 60, 20, 60, 20, 60, 20, 60}},
+    {"pentagram", 5, {64, 90, 22, 106, 38}, {2, 62, 24, 24, 62}},
+    {"bowtie", 4, {10, 118, 118, 10}, {10, 54, 10, 54}},
+    {"double loop",
+     8,
+     {20, 100, 100, 30, 30, 110, 110, 20},
+     {10, 10, 50, 50, 20, 20, 60, 60}},
+    {"large triangle", 3, {-30000, 30000, 64}, {-30000, -20000, 30000}},
+    {"large pentagram",
+     5,
+     {64, 30000, -30000, 30000, -30000},
+     {-30000, 30000, -7000, -7000, 30000}},
+    {"large sliver", 4, {-30000, 30000, 30000, -30000}, {31, 33, 34, 32}},
+};
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// 1 if the center of pixel x,y is inside the shape. An edge counts if it
+// crosses the row of the center at or left of the center, with all
+// coordinates doubled so that the test is exact.
+static int ref_inside(const shape_t *s, uint8_t fill_rule, int x, int y)
+{
+  int winding = 0;
+  for (int i = 0; i < s->cnt; i++) {
+    int j = (i + 1) % s->cnt;
+    int64_t xa = s->x[i], ya = s->y[i], xb = s->x[j], yb = s->y[j];
+    int dir = 1;
+    if (ya == yb)
+      continue;
+    if (ya > yb) {
+      int64_t t = xa;
+      xa = xb;
+      xb = t;
+      t = ya;
+      ya = yb;
+      yb = t;
+      dir = -1;
+    }
+    if (2 * y + 1 < 2 * ya || 2 * y + 1 > 2 * yb)
+      continue;
+    if (2 * xa * (yb - ya) + (2 * y + 1 - 2 * ya) * (xb - xa) <=
+        (2 * x + 1) * (yb - ya))
+      winding += dir;
+  }
+  if (fill_rule == U8G2_POLYGON_NON_ZERO)
+    return winding != 0;
+  return winding & 1;
+}
+
+// Fill the shape with u8g2_FillPolygon(), or through u8g2_SetPolygon()
+// and u8g2_DrawPolygon()
+static void fill_shape(u8g2_t *u8g2, const shape_t *s, uint8_t fill_rule,
+                       int use_draw_polygon)
+{
+  u8g2_polygon_vertex_t vertices[MAX_VERTICES];
+  u8g2_polygon_t pg;
+  u8g2_InitPolygon(&pg, vertices, MAX_VERTICES);
+  u8g2_SetPolygonFillRule(&pg, fill_rule);
+  if (use_draw_polygon) {
+    u8g2_SetPolygon(u8g2, &pg);
+    for (int i = 0; i < s->cnt; i++)
+      u8g2_AddPolygonXY(u8g2, s->x[i], s->y[i]);
+    u8g2_DrawPolygon(u8g2);
+    u8g2_SetPolygon(u8g2, NULL);
+  } else {
+    for (int i = 0; i < s->cnt; i++)
+      u8g2_AddPolygonVertex(&pg, s->x[i], s->y[i]);
+    u8g2_FillPolygon(u8g2, &pg);
+  }
+}
+
+// Compare the filled shape with the reference pixels, exit if they differ
+static void check_shape(u8g2_t *u8g2, const shape_t *s, uint8_t *ref,
+                        int use_draw_polygon)
+{
+  size_t buf_size = buffer_size(u8g2);
+  int w = u8g2_GetDisplayWidth(u8g2);
+  int h = u8g2_GetDisplayHeight(u8g2);
+  for (uint8_t rule = 0; rule < 2; rule++) {
+    memset(u8g2->tile_buf_ptr, 0, buf_size);
+    for (int y = 0; y < h; y++)
+      for (int x = 0; x < w; x++)
+        if (ref_inside(s, rule, x, y))
+          u8g2_DrawPixel(u8g2, x, y);
+    memcpy(ref, u8g2->tile_buf_ptr, buf_size);
+
+    memset(u8g2->tile_buf_ptr, 0, buf_size);
+    fill_shape(u8g2, s, rule, use_draw_polygon);
+    if (memcmp(ref, u8g2->tile_buf_ptr, buf_size) != 0) {
+      fprintf(stderr, "%s with %d vertices: %s fill differs\n", s->name,
+              s->cnt, rule == U8G2_POLYGON_NON_ZERO ? "non-zero" : "even-odd");
+      exit(1);
+    }
+  }
+}
+
+// Random polygon, vertices near the display with a few far outside
+static void random_shape(u8g2_t *u8g2, shape_t *s)
+{
+  int w = u8g2_GetDisplayWidth(u8g2);
+  int h = u8g2_GetDisplayHeight(u8g2);
+  int far = rand() % 4 == 0;
+  s->name = far ? "random large" : "random";
+  s->cnt = 3 + rand() % (MAX_VERTICES - 2);
+  for (int i = 0; i < s->cnt; i++) {
+    if (far && rand() % 3 == 0) {
+      s->x[i] = rand() % 60001 - 30000;
+      s->y[i] = rand() % 60001 - 30000;
+    } else {
+      s->x[i] = rand() % (w + 40) - 20;
+      s->y[i] = rand() % (h + 40) - 20;
+    }
+  }
+}
+
+// Check the fixed and the random shapes, with and without a clip window
+static void check_polygons(u8g2_t *u8g2)
+{
+  uint8_t *ref = (uint8_t *)malloc(buffer_size(u8g2));
+  const int num_fixed = sizeof(fixed_shapes) / sizeof(fixed_shapes[0]);
+  shape_t s;
+  u8g2_SetDrawColor(u8g2, 1);
+  srand(1);
+  for (int clip = 0; clip < 2; clip++) {
+    if (clip)
+      u8g2_SetClipWindow(u8g2, 21, 9, 99, 47);
+    for (int i = 0; i < num_fixed; i++)
+      check_shape(u8g2, &fixed_shapes[i], ref, i & 1);
+    for (int i = 0; i < NUM_RANDOM; i++) {
+      random_shape(u8g2, &s);
+      check_shape(u8g2, &s, ref, i & 1);
+    }
+  }
+  u8g2_SetMaxClipWindow(u8g2);
+  free(ref);
+}
+
+// Draw the hexagon of the global polygon, 0: u8g2_DrawPolygon(),
+// 1: u8g2_FillPolygon(), and return draws per second
+static double test_draws(u8g2_t *u8g2, int method, long draws)
+{
+  static const int16_t hx[] = {30, 70, 100, 90, 50, 20};
+  static const int16_t hy[] = {5, 2, 20, 60, 62, 40};
+  u8g2_polygon_vertex_t vertices[6];
+  u8g2_polygon_t pg;
+  u8g2_InitPolygon(&pg, vertices, 6);
+
+  double start = now_secs();
+  for (long i = 0; i < draws; i++) {
+    int d = i % 8;
+    if (method == 0) {
+      u8g2_ClearPolygonXY();
+      for (int j = 0; j < 6; j++)
+        u8g2_AddPolygonXY(u8g2, hx[j] + d, hy[j]);
+      u8g2_DrawPolygon(u8g2);
+    } else {
+      u8g2_ClearPolygon(&pg);
+      for (int j = 0; j < 6; j++)
+        u8g2_AddPolygonVertex(&pg, hx[j] + d, hy[j]);
+      u8g2_FillPolygon(u8g2, &pg);
+    }
+  }
+  return draws / (now_secs() - start);
+}
+
+int main(int argc, char *argv[])
+{
+  long draws = (argc > 1) ? atol(argv[1]) : 200000;
+
+  const char *buffer_names[] = {"vertical", "horizontal"};
+  printf("%-10s %16s %16s %8s\n", "buffer", "global draws/s", "fill draws/s",
+         "speedup");
+  for (int buf = 0; buf < 2; buf++) {
+    u8g2_t u8g2;
+    if (buf == 0)
+      u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                         u8x8_dummy_cb);
+    else
+      u8g2_Setup_st7920_s_128x64_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                   u8x8_dummy_cb);
+    check_polygons(&u8g2);
+    double a = test_draws(&u8g2, 0, draws);
+    double b = test_draws(&u8g2, 1, draws);
+    printf("%-10s %16.0f %16.0f %7.2fx\n", buffer_names[buf], a, b, b / a);
+  }
+
+  return 0;
+}
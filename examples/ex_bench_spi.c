@@ -0,0 +1,74 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example measuring hardware SPI throughput with each
+ transmit mode
+
+ No display is required: connect MOSI to MISO on the SPI header for a
+ loopback test, or run against any free /dev/spidevN.M device.
+
+ Usage: ex_bench_spi [bus_number [cs_number [speed_mhz [frames]]]]
+*/
+
+#include <libu8g2arm/u8g2.h>
+#include <libu8g2arm/u8g2arm.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double send_frames(u8g2_t *u8g2, int frames)
+{
+  double start = now_secs();
+  for (int i = 0; i < frames; i++) {
+    u8g2_SendBuffer(u8g2);
+  }
+  return now_secs() - start;
+}
+
+int main(int argc, char *argv[])
+{
+  int bus_number = (argc > 1) ? atoi(argv[1]) : 0;
+  int cs_number = (argc > 2) ? atoi(argv[2]) : 0;
+  int speed_mhz = (argc > 3) ? atoi(argv[3]) : 8;
+  int frames = (argc > 4) ? atoi(argv[4]) : 200;
+
+  u8g2_t u8g2;
+  u8x8_t *p_u8x8 = u8g2_GetU8x8(&u8g2);
+
+  // An SSD1306 128x64 sends 1024 data bytes (8 tile rows) per frame
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0,
+                                     u8x8_byte_arm_linux_hw_spi,
+                                     u8x8_arm_linux_gpio_and_delay);
+  if (!u8g2arm_arm_init_hw_spi(p_u8x8, bus_number, cs_number, speed_mhz)) {
+    fprintf(stderr, "could not initialise SPI device\n");
+    exit(1);
+  }
+  u8g2_InitDisplay(&u8g2);
+
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_DrawBox(&u8g2, 16, 8, 96, 48);
+
+  long frame_bytes = (long)u8g2_GetBufferTileWidth(&u8g2) * 8 *
+                     u8g2_GetBufferTileHeight(&u8g2);
+  printf("spidev%d.%d at %d MHz, %d frames of %ld bytes\n", bus_number,
+         cs_number, speed_mhz, frames, frame_bytes);
+
+  const char *mode_names[] = {"byte", "batch"};
+  int modes[] = {U8G2ARM_TX_BYTE, U8G2ARM_TX_BATCH};
+  for (int i = 0; i < 2; i++) {
+    u8g2arm_arm_set_tx_mode(p_u8x8, modes[i]);
+    double secs = send_frames(&u8g2, frames);
+    printf("%-6s %8.3f s  %10.0f bytes/s  %7.1f frames/s\n", mode_names[i],
+           secs, frames * frame_bytes / secs, frames / secs);
+  }
+
+  return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_DrawXBM() with drawing
+ the same icons as sprites, with u8g2_DrawSprite() and with u8g2_DrawXBM()
+ and a sprite cache, for 8x8, 16x16 and 32x32 icons, in each display
+ rotation, for a vertical_top_lsb buffer (SSD1306) and a
+ horizontal_right_lsb buffer (ST7920)
+
+ No display is required.
+
+ Usage: ex_bench_sprite [draws_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ICONS 8
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// 0: u8g2_DrawXBM(), 1: u8g2_DrawSprite(), 2: u8g2_DrawXBM() with a cache
+static void draw_icon(u8g2_t *u8g2, int method, u8g2_uint_t x, u8g2_uint_t y,
+                      u8g2_uint_t size, const uint8_t *bitmap,
+                      const u8g2_sprite_t *sprite)
+{
+  if (method == 1)
+    u8g2_DrawSprite(u8g2, x, y, sprite);
+  else
+    u8g2_DrawXBM(u8g2, x, y, size, size, bitmap);
+}
+
+// Draw the icons at positions across the display with each draw colour
+// and bitmap mode, and return draws per second
+static double test_draws(u8g2_t *u8g2, int method, u8g2_uint_t size,
+                         const uint8_t *bitmaps[], const u8g2_sprite_t *sprites,
+                         long draws)
+{
+  u8g2_uint_t width = u8g2_GetDisplayWidth(u8g2);
+  u8g2_uint_t height = u8g2_GetDisplayHeight(u8g2);
+  double start = now_secs();
+  for (long i = 0; i < draws; i++) {
+    u8g2_SetDrawColor(u8g2, i % 3);
+    u8g2_SetBitmapMode(u8g2, (i / 3) % 2);
+    draw_icon(u8g2, method, (i * 7) % (width - size + 1),
+              (i * 5) % (height - size + 1), size, bitmaps[i % ICONS],
+              sprites + i % ICONS);
+  }
+  return draws / (now_secs() - start);
+}
+
+// Check that the three methods give the same buffer, including icons
+// which are partly outside the display
+static void check_same(u8g2_t *u8g2, u8g2_uint_t size,
+                       const uint8_t *bitmaps[], const u8g2_sprite_t *sprites,
+                       u8g2_sprite_cache_t *cache)
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  for (int method = 0; method < 3; method++) {
+    srand(1);
+    memset(u8g2->tile_buf_ptr, 0x5a, buf_size);
+    u8g2_SetSpriteCache(u8g2, method == 2 ? cache : NULL);
+    for (int i = 0; i < 2000; i++) {
+      u8g2_uint_t x = rand() % 160 - 16;
+      u8g2_uint_t y = rand() % 160 - 16;
+      int icon = rand() % ICONS;
+      u8g2_SetDrawColor(u8g2, rand() % 3);
+      u8g2_SetBitmapMode(u8g2, rand() % 2);
+      draw_icon(u8g2, method, x, y, size, bitmaps[icon], sprites + icon);
+    }
+    if (method == 0)
+      memcpy(ref, u8g2->tile_buf_ptr, buf_size);
+    else if (memcmp(ref, u8g2->tile_buf_ptr, buf_size) != 0) {
+      fprintf(stderr, "buffers differ\n");
+      exit(1);
+    }
+  }
+  u8g2_SetSpriteCache(u8g2, NULL);
+  free(ref);
+}
+
+int main(int argc, char *argv[])
+{
+  long draws = (argc > 1) ? atol(argv[1]) : 200000;
+
+  // Random pixels for the icons
+  static uint8_t pixels[ICONS][32 / 8 * 32];
+  const uint8_t *bitmaps[ICONS];
+  srand(1);
+  for (int i = 0; i < ICONS; i++) {
+    for (size_t j = 0; j < sizeof(pixels[i]); j++)
+      pixels[i][j] = rand();
+    bitmaps[i] = pixels[i];
+  }
+
+  // One sprite for each icon, and a cache with a slot for each icon
+  static uint8_t sprite_data[ICONS][8 * 32 * 5];
+  static uint8_t cache_data[ICONS][8 * 32 * 5];
+  u8g2_sprite_t sprites[ICONS];
+  u8g2_sprite_t cache_sprites[ICONS];
+  u8g2_sprite_cache_t cache;
+
+  const u8g2_cb_t *rotations[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3};
+  const char *buffer_names[] = {"vertical", "horizontal"};
+  const u8g2_uint_t sizes[] = {8, 16, 32};
+  printf("%-10s %3s %5s %14s %14s %14s %8s\n", "buffer", "rot", "icon",
+         "xbm draws/s", "sprite draws/s", "cache draws/s", "speedup");
+  for (int buf = 0; buf < 2; buf++) {
+    for (int rot = 0; rot < 4; rot++) {
+      u8g2_t u8g2;
+      if (buf == 0)
+        u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, rotations[rot],
+                                           u8x8_byte_empty, u8x8_dummy_cb);
+      else
+        u8g2_Setup_st7920_s_128x64_f(&u8g2, rotations[rot], u8x8_byte_empty,
+                                     u8x8_dummy_cb);
+      for (int s = 0; s < 3; s++) {
+        u8g2_uint_t size = sizes[s];
+        for (int i = 0; i < ICONS; i++)
+          u8g2_InitSprite(&u8g2, sprites + i, size, size, bitmaps[i],
+                          sprite_data[i]);
+        u8g2_InitSpriteCache(&cache, cache_sprites, ICONS, cache_data[0],
+                             sizeof(cache_data[0]));
+
+        check_same(&u8g2, size, bitmaps, sprites, &cache);
+        double a = test_draws(&u8g2, 0, size, bitmaps, sprites, draws);
+        double b = test_draws(&u8g2, 1, size, bitmaps, sprites, draws);
+        u8g2_SetSpriteCache(&u8g2, &cache);
+        double c = test_draws(&u8g2, 2, size, bitmaps, sprites, draws);
+        u8g2_SetSpriteCache(&u8g2, NULL);
+
+        char name[16];
+        snprintf(name, sizeof(name), "%dx%d", size, size);
+        printf("%-10s %3d %5s %14.0f %14.0f %14.0f %7.2fx\n",
+               buffer_names[buf], rot * 90, name, a, b, c, b / a);
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm example comparing the speed of u8g2_DrawStr() and
+ u8g2_DrawTextAtom() for fixed labels, in a small, a medium and a large
+ font, for a vertical_top_lsb buffer (SSD1306) and a horizontal_right_lsb
+ buffer (ST7920)
+
+ No display is required.
+
+ Usage: ex_bench_text_atom [strings_per_test]
+*/
+
+#include <libu8g2arm/u8g2.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LABELS 4
+
+static const char *labels[LABELS] = {"Temp", "Volt", "Speed", "Level"};
+
+static double now_secs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t buffer_size(u8g2_t *u8g2)
+{
+  return u8g2_GetBufferTileWidth(u8g2) * 8 * u8g2_GetBufferTileHeight(u8g2);
+}
+
+// Draw the labels with u8g2_DrawStr(), or from the atoms if atoms is not
+// NULL, and return strings per second
+static double test_labels(u8g2_t *u8g2, u8g2_text_atom_t *atoms, long cnt)
+{
+  double start = now_secs();
+  for (long i = 0; i < cnt; i++) {
+    u8g2_uint_t x = (i * 7) % 64, y = 20 + (i * 5) % 40;
+    if (atoms == NULL)
+      u8g2_DrawStr(u8g2, x, y, labels[i % LABELS]);
+    else
+      u8g2_DrawTextAtom(u8g2, x, y, &atoms[i % LABELS]);
+  }
+  return cnt / (now_secs() - start);
+}
+
+// Check that the atoms draw the same as u8g2_DrawStr() in transparent
+// mode, in each font direction, with draw colours 0 and 1 and partly
+// outside the display
+static void check_same(u8g2_t *u8g2)
+{
+  size_t buf_size = buffer_size(u8g2);
+  uint8_t *ref = (uint8_t *)malloc(buf_size);
+  u8g2_SetFontMode(u8g2, 1);
+  for (int dir = 0; dir < 4; dir++) {
+    u8g2_SetFontDirection(u8g2, dir);
+    for (int i = 0; i < LABELS; i++) {
+      u8g2_text_atom_t atom;
+      uint32_t size = u8g2_GetStrAtomDataSize(u8g2, labels[i]);
+      uint8_t *data = (uint8_t *)malloc(size);
+      u8g2_InitStrAtom(u8g2, &atom, labels[i], data, size);
+      for (int pass = 0; pass < 2; pass++) {
+        srand(dir * LABELS + i);
+        memset(u8g2->tile_buf_ptr, 0x5a, buf_size);
+        for (int j = 0; j < 50; j++) {
+          u8g2_uint_t x = rand() % 160 - 16, y = rand() % 100 - 16;
+          u8g2_SetDrawColor(u8g2, rand() % 2);
+          if (pass == 0)
+            u8g2_DrawStr(u8g2, x, y, labels[i]);
+          else
+            u8g2_DrawTextAtom(u8g2, x, y, &atom);
+        }
+        if (pass == 0)
+          memcpy(ref, u8g2->tile_buf_ptr, buf_size);
+        else if (memcmp(ref, u8g2->tile_buf_ptr, buf_size) != 0) {
+          fprintf(stderr, "buffers differ\n");
+          exit(1);
+        }
+      }
+      free(data);
+    }
+  }
+  u8g2_SetFontDirection(u8g2, 0);
+  u8g2_SetFontMode(u8g2, 0);
+  u8g2_SetDrawColor(u8g2, 1);
+  free(ref);
+}
+
+int main(int argc, char *argv[])
+{
+  long cnt = (argc > 1) ? atol(argv[1]) : 200000;
+
+  const uint8_t *fonts[] = {u8g2_font_6x10_tf, u8g2_font_helvB12_tr,
+                            u8g2_font_logisoso32_tr};
+  const char *font_names[] = {"6x10_tf", "helvB12_tr", "logisoso32_tr"};
+  const char *buffer_names[] = {"vertical", "horizontal"};
+
+  printf("%-10s %-14s %6s %14s %14s %8s\n", "buffer", "font", "bytes",
+         "DrawStr str/s", "atom str/s", "speedup");
+  for (int buf = 0; buf < 2; buf++) {
+    u8g2_t u8g2;
+    if (buf == 0)
+      u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                         u8x8_dummy_cb);
+    else
+      u8g2_Setup_st7920_s_128x64_f(&u8g2, U8G2_R0, u8x8_byte_empty,
+                                   u8x8_dummy_cb);
+    for (int f = 0; f < 3; f++) {
+      u8g2_SetFont(&u8g2, fonts[f]);
+      check_same(&u8g2);
+
+      // Build the atoms in solid mode, as u8g2_DrawStr() draws below
+      u8g2_text_atom_t atoms[LABELS];
+      uint8_t *data[LABELS];
+      uint32_t bytes = 0;
+      for (int i = 0; i < LABELS; i++) {
+        uint32_t size = u8g2_GetStrAtomDataSize(&u8g2, labels[i]);
+        data[i] = (uint8_t *)malloc(size);
+        u8g2_InitStrAtom(&u8g2, &atoms[i], labels[i], data[i], size);
+        bytes += size;
+      }
+
+      double a = test_labels(&u8g2, NULL, cnt);
+      double b = test_labels(&u8g2, atoms, cnt);
+      printf("%-10s %-14s %6u %14.0f %14.0f %7.2fx\n", buffer_names[buf],
+             font_names[f], (unsigned)bytes, a, b, b / a);
+      for (int i = 0; i < LABELS; i++)
+        free(data[i]);
+    }
+  }
+
+  return 0;
+}
@@ -127,7 +127,7 @@ int main(int argc, char *argv[])
     exit(1);
   }
 
-  auto u8g2 = *p_u8g2;
+  auto &u8g2 = *p_u8g2;
 
   // U8g2 begin
   u8g2.begin();
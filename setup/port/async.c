@@ -0,0 +1,200 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm asynchronous u8g2_SendBuffer() from a transmit thread
+*/
+
+#include "async.h"
+#include "u8g2arm.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct u8g2arm_async_t {
+  u8g2_t *u8g2;
+  size_t buf_size;
+  uint8_t *tx_buf;    // frame being sent by the thread
+  uint8_t *held_buf;  // frame waiting to be sent
+  int policy;
+  int held;           // held_buf contains a frame
+  int busy;           // the thread is sending tx_buf
+  int stop;
+  unsigned long sent;
+  unsigned long skipped;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t work;  // a frame is held, or the thread should stop
+  pthread_cond_t done;  // a frame was taken or sent
+};
+
+static int valid_policy(int policy)
+{
+  return policy == U8G2ARM_ASYNC_BLOCK || policy == U8G2ARM_ASYNC_DROP ||
+         policy == U8G2ARM_ASYNC_COALESCE;
+}
+
+// Send the transmit buffer as u8g2_SendBuffer() sends the U8g2 buffer
+static void send_frame(u8g2arm_async_t *async)
+{
+  u8x8_t *u8x8 = u8g2_GetU8x8(async->u8g2);
+  uint8_t w = u8x8->display_info->tile_width;
+  uint8_t h = u8x8->display_info->tile_height;
+  uint8_t row;
+
+  for(row = 0; row < h; row++)
+    u8x8_DrawTile(u8x8, 0, row, w, async->tx_buf + (size_t)row * w * 8);
+  u8x8_RefreshDisplay(u8x8);
+  u8g2arm_arm_flush(u8x8);
+}
+
+static void *tx_thread(void *arg)
+{
+  u8g2arm_async_t *async = (u8g2arm_async_t *)arg;
+  uint8_t *tmp;
+
+  pthread_mutex_lock(&async->lock);
+  for(;;) {
+    while(!async->held && !async->stop)
+      pthread_cond_wait(&async->work, &async->lock);
+    if(!async->held)
+      break;
+
+    tmp = async->tx_buf;
+    async->tx_buf = async->held_buf;
+    async->held_buf = tmp;
+    async->held = 0;
+    async->busy = 1;
+    pthread_cond_broadcast(&async->done);
+    pthread_mutex_unlock(&async->lock);
+
+    send_frame(async);
+
+    pthread_mutex_lock(&async->lock);
+    async->busy = 0;
+    async->sent++;
+    pthread_cond_broadcast(&async->done);
+  }
+  pthread_mutex_unlock(&async->lock);
+  return NULL;
+}
+
+u8g2arm_async_t *u8g2arm_arm_async_start(u8g2_t *u8g2, int policy)
+{
+  u8x8_t *u8x8 = u8g2_GetU8x8(u8g2);
+  if(!valid_policy(policy))
+    return NULL;
+  if(u8g2->tile_buf_height < u8x8->display_info->tile_height) {
+    printf("asynchronous send requires a full buffer (_f) display\n");
+    return NULL;
+  }
+
+  u8g2arm_async_t *async = (u8g2arm_async_t *)calloc(1, sizeof(u8g2arm_async_t));
+  if(async == NULL)
+    return NULL;
+  async->u8g2 = u8g2;
+  async->policy = policy;
+  async->buf_size = (size_t)u8x8->display_info->tile_width * 8 *
+                    u8x8->display_info->tile_height;
+  async->tx_buf = (uint8_t *)malloc(async->buf_size);
+  async->held_buf = (uint8_t *)malloc(async->buf_size);
+  if(async->tx_buf == NULL || async->held_buf == NULL) {
+    free(async->tx_buf);
+    free(async->held_buf);
+    free(async);
+    return NULL;
+  }
+
+  pthread_mutex_init(&async->lock, NULL);
+  pthread_cond_init(&async->work, NULL);
+  pthread_cond_init(&async->done, NULL);
+  if(pthread_create(&async->thread, NULL, tx_thread, async) != 0) {
+    perror("pthread_create");
+    pthread_cond_destroy(&async->done);
+    pthread_cond_destroy(&async->work);
+    pthread_mutex_destroy(&async->lock);
+    free(async->tx_buf);
+    free(async->held_buf);
+    free(async);
+    return NULL;
+  }
+  return async;
+}
+
+int u8g2arm_arm_async_set_policy(u8g2arm_async_t *async, int policy)
+{
+  if(!valid_policy(policy))
+    return 0;
+  pthread_mutex_lock(&async->lock);
+  async->policy = policy;
+  pthread_mutex_unlock(&async->lock);
+  return 1;
+}
+
+int u8g2arm_arm_async_send_buffer(u8g2arm_async_t *async)
+{
+  pthread_mutex_lock(&async->lock);
+  if(async->busy || async->held) {
+    if(async->policy == U8G2ARM_ASYNC_DROP) {
+      async->skipped++;
+      pthread_mutex_unlock(&async->lock);
+      return 0;
+    }
+    else if(async->policy == U8G2ARM_ASYNC_BLOCK) {
+      while(async->busy || async->held)
+        pthread_cond_wait(&async->done, &async->lock);
+    }
+    else if(async->held) {  // U8G2ARM_ASYNC_COALESCE
+      async->skipped++;
+    }
+  }
+
+  memcpy(async->held_buf, async->u8g2->tile_buf_ptr, async->buf_size);
+  async->held = 1;
+  pthread_cond_signal(&async->work);
+  pthread_mutex_unlock(&async->lock);
+  return 1;
+}
+
+void u8g2arm_arm_async_wait(u8g2arm_async_t *async)
+{
+  pthread_mutex_lock(&async->lock);
+  while(async->busy || async->held)
+    pthread_cond_wait(&async->done, &async->lock);
+  pthread_mutex_unlock(&async->lock);
+}
+
+unsigned long u8g2arm_arm_async_frames_sent(u8g2arm_async_t *async)
+{
+  pthread_mutex_lock(&async->lock);
+  unsigned long cnt = async->sent;
+  pthread_mutex_unlock(&async->lock);
+  return cnt;
+}
+
+unsigned long u8g2arm_arm_async_frames_skipped(u8g2arm_async_t *async)
+{
+  pthread_mutex_lock(&async->lock);
+  unsigned long cnt = async->skipped;
+  pthread_mutex_unlock(&async->lock);
+  return cnt;
+}
+
+void u8g2arm_arm_async_stop(u8g2arm_async_t *async)
+{
+  if(async == NULL)
+    return;
+  pthread_mutex_lock(&async->lock);
+  async->stop = 1;
+  pthread_cond_signal(&async->work);
+  pthread_mutex_unlock(&async->lock);
+  pthread_join(async->thread, NULL);
+
+  pthread_cond_destroy(&async->done);
+  pthread_cond_destroy(&async->work);
+  pthread_mutex_destroy(&async->lock);
+  free(async->tx_buf);
+  free(async->held_buf);
+  free(async);
+}
@@ -0,0 +1,100 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm delays for the GPIO and delay callback
+*/
+
+#include "delay.h"
+
+#include <pthread.h>
+
+#define CALIBRATE_LOOPS 200000UL
+
+static unsigned long spin_threshold_ns = DELAY_SPIN_THRESHOLD_NS;
+
+// Set once by calibrate(), and only read after delay_init() returns
+static pthread_once_t calibrate_once = PTHREAD_ONCE_INIT;
+static unsigned long clock_read_ns = 0;  // time taken to read the clock
+static uint32_t loops_per_ns_q16 = 0;    // spin loops per ns (16.16 fixed)
+
+static uint64_t raw_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void spin_loops(unsigned long loops)
+{
+    volatile unsigned long i;
+    for (i = 0; i < loops; i++)
+        ;
+}
+
+static void calibrate(void)
+{
+    uint64_t start, elapsed, best = UINT64_MAX;
+    int i;
+
+    // the fastest of several runs is the least disturbed by the scheduler
+    for (i = 0; i < 3; i++)
+    {
+        start = raw_now_ns();
+        spin_loops(CALIBRATE_LOOPS);
+        elapsed = raw_now_ns() - start;
+        if (elapsed < best)
+            best = elapsed;
+    }
+    if (best == 0)
+        best = 1;
+    loops_per_ns_q16 = (uint32_t)(((uint64_t)CALIBRATE_LOOPS << 16) / best);
+    if (loops_per_ns_q16 == 0)
+        loops_per_ns_q16 = 1;
+
+    start = raw_now_ns();
+    for (i = 0; i < 100; i++)
+        raw_now_ns();
+    clock_read_ns = (raw_now_ns() - start) / 100;
+}
+
+void delay_init(void)
+{
+    pthread_once(&calibrate_once, calibrate);
+}
+
+void delay_set_spin_threshold(unsigned long nanoseconds)
+{
+    spin_threshold_ns = nanoseconds;
+}
+
+unsigned long delay_get_spin_threshold(void)
+{
+    return spin_threshold_ns;
+}
+
+void delay_ns(unsigned long nanoseconds)
+{
+    struct timespec ts;
+    uint64_t end;
+
+    if (nanoseconds >= spin_threshold_ns)
+    {
+        ts.tv_sec = nanoseconds / 1000000000UL;
+        ts.tv_nsec = nanoseconds % 1000000000UL;
+        clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, NULL);
+        return;
+    }
+
+    delay_init();
+
+    if (nanoseconds < 4 * clock_read_ns)
+    {
+        // too short to time with the clock, count loops instead
+        spin_loops(((uint64_t)nanoseconds * loops_per_ns_q16) >> 16);
+        return;
+    }
+
+    end = raw_now_ns() + nanoseconds;
+    while (raw_now_ns() < end)
+        ;
+}
@@ -0,0 +1,30 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm delays for the GPIO and delay callback
+*/
+
+#ifndef DELAY_H
+#define DELAY_H
+
+#include <stdint.h>
+#include <time.h>
+
+// Short delays are busy-waited with a spin loop calibrated against
+// CLOCK_MONOTONIC_RAW, longer delays sleep with clock_nanosleep
+
+// Default length below which delays are busy-waited
+#define DELAY_SPIN_THRESHOLD_NS (50000)
+
+// Calibrate the spin loop, once for the process, so delays can run on
+// several threads (done on the first busy-waited delay if not called)
+void delay_init(void);
+
+// Set the length (ns) below which delays are busy-waited (set it before
+// the displays are used from other threads)
+void delay_set_spin_threshold(unsigned long nanoseconds);
+unsigned long delay_get_spin_threshold(void);
+
+void delay_ns(unsigned long nanoseconds);
+
+#endif
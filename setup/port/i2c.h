@@ -25,6 +25,7 @@
 #define I2C_H
 
 #include <linux/i2c-dev.h>
+#include <linux/i2c.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <unistd.h>
@@ -35,7 +36,8 @@
 
 int openI2CDevice(const char* device);
 void setI2CSlave(int i2c_fd,int addr);			
-void I2CWriteBytes(int i2c_fd, uint8_t* data, uint8_t length);
+int I2CWriteBytes(int i2c_fd, uint8_t* data, uint16_t length);
+int I2CWriteMessages(int i2c_fd, struct i2c_msg* msgs, uint32_t count);
 
 void sleep_ms(unsigned long milliseconds);
 void sleep_us(unsigned long microseconds);
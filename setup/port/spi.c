@@ -102,7 +102,37 @@ int SPITransfer(int fd, struct spi_ioc_transfer* tr)
     return 0;
 }
 
+// Send n chained transfers in a single message
+int SPITransferN(int fd, struct spi_ioc_transfer* tr, unsigned int n)
+{
+    int ret;
+    ret = ioctl(fd, SPI_IOC_MESSAGE(n), tr);
+    if (ret < 1)
+    {
+        pabort("can't send spi message");
+    }
+
+    return 0;
+}
+
 void closeSPIDevice(int fd)
 {
     close(fd);
 }
+
+// Largest number of bytes that spidev accepts in one SPI_IOC_MESSAGE
+uint32_t getSPIBufSize(void)
+{
+    unsigned long bufsiz = 0;
+    FILE *fp = fopen("/sys/module/spidev/parameters/bufsiz", "r");
+    if (fp)
+    {
+        if (fscanf(fp, "%lu", &bufsiz) != 1)
+        {
+            bufsiz = 0;
+        }
+        fclose(fp);
+    }
+
+    return bufsiz ? bufsiz : SPI_DEFAULT_BUFSIZ;
+}
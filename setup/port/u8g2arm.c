@@ -23,58 +23,412 @@
 
 #include "u8g2arm.h"
 
-#define DEV_NAME_LEN 32 // maximum length of I2C/SPI device name
-static char dev_name[DEV_NAME_LEN];
+#include <pthread.h>
 
-// Hold details about an I2C or SPI device
+#define DEV_NAME_LEN 32 // maximum length of I2C/SPI device name
+#define GPIO_CHIP_PATH_LEN 64 // maximum length of GPIO chip path
+
+#define TX_BUF_LEN 4096     // maximum bytes held for one SPI/I2C ioctl
+#define SPI_TX_MAX_SEGS 16  // maximum DC runs held for one transaction
+#define I2C_TX_MAX_MSGS I2C_RDWR_IOCTL_MAX_MSGS // messages per I2C_RDWR
+#define GPIO_TIMING_CALLS 16 // GPIO calls timed to find the call latency
+#define DC_LEVEL_UNKNOWN 0xff
+#define I2C_ADDR_UNKNOWN -1
+
+// Transfer kept open by u8x8_cad_ssd13xx_linux_i2c
+#define CAD_NONE 0
+#define CAD_CMD  1
+#define CAD_DATA 2
+
+// A run of held SPI bytes sent with the same DC level
+typedef struct spi_seg_t {
+  uint16_t start;       // offset of the first byte in tx_buf
+  uint8_t dc;           // DC level for the run
+} spi_seg_t;
+
+// Hold details about the GPIO chip and I2C or SPI device of a display
 //   SPI device name: /dev/spidevN.M with N=bus_number, M=CS_number
 //   I2C device name: /dev/i2c-N with N=bus_number
 typedef struct u8g2arm_setup_t {
+  gpio_chip_t *gpio_chip; // GPIO   - chip (set when the pins are requested)
+  char gpio_chip_path[GPIO_CHIP_PATH_LEN]; // GPIO - chip path ("": default)
+  unsigned long gpio_call_ns; // GPIO - time taken by a GPIO call (0: unknown)
+  char dev_name[DEV_NAME_LEN]; // SPI/I2C - device name
   int dev_fd;           // SPI/I2C  - file descriptor (set when opened)
   uint8_t bus_number;   // SPI/I2C  - bus number
   uint8_t cs_number;    // SPI only - chip select number
   uint32_t spi_hz;      // SPI only - speed in Hz
+  uint8_t dc_level;     // SPI only - level last written to the DC line
+  uint8_t seg_cnt;      // SPI only - number of runs in seg
+  spi_seg_t seg[SPI_TX_MAX_SEGS]; // SPI only - DC runs waiting to be sent
+  int i2c_addr;         // I2C only - slave address last set on dev_fd
+  uint8_t cad_state;    // I2C only - open transfer of the Linux I2C CAD
+  uint8_t tx_overflow;  // I2C only - open transfer did not fit in tx_buf
+  uint8_t tx_error;     // I2C only - a transfer failed since the last flush
+  uint8_t msg_cnt;      // I2C only - number of completed messages held
+  uint16_t msg_start[I2C_TX_MAX_MSGS + 1]; // I2C only - message offsets
+  uint8_t tx_mode;      // SPI/I2C  - U8G2ARM_TX_BYTE or U8G2ARM_TX_BATCH
+  uint16_t tx_max;      // SPI/I2C  - flush when tx_len reaches this
+  uint16_t tx_len;      // SPI/I2C  - number of bytes waiting in tx_buf
+  uint8_t tx_buf[TX_BUF_LEN]; // SPI/I2C - bytes waiting to be sent
+  struct u8g2arm_setup_t *next; // next details allocated by the port
 } u8g2arm_setup_t;
 
+// All the display details allocated by the port. The U8X8 setup
+// functions leave the user pointer unchanged, so a display that is set
+// up again still points to its details, and a new display may point
+// anywhere: the user pointer is only taken as details if it is listed.
+static u8g2arm_setup_t *setup_list = NULL;
+static pthread_mutex_t setup_list_lock = PTHREAD_MUTEX_INITIALIZER;
+
 static u8g2arm_setup_t *get_setup_ptr(u8x8_t *u8x8)
 {
    return u8x8_GetUserPtr(u8x8);
 }
 
-int u8g2arm_arm_init_hw_spi(u8x8_t *u8x8, int bus_number, int cs_number,
-    int spi_mhz)
+// The user pointer only holds the details of a display driven by one of
+// the byte drivers below
+static int is_port_byte_cb(u8x8_t *u8x8)
+{
+  return u8x8->byte_cb == u8x8_byte_arm_linux_hw_spi ||
+         u8x8->byte_cb == u8x8_byte_arm_linux_hw_i2c ||
+         u8x8->byte_cb == u8x8_byte_arm_linux_4wire_sw_spi ||
+         u8x8->byte_cb == u8x8_byte_arm_linux_3wire_sw_spi ||
+         u8x8->byte_cb == u8x8_byte_arm_linux_sw_i2c ||
+         u8x8->byte_cb == u8x8_byte_arm_linux_8bit_8080mode;
+}
+
+int u8g2arm_arm_is_port_byte_cb(u8x8_t *u8x8)
+{
+  return is_port_byte_cb(u8x8);
+}
+
+// Details allocated by the port for the display, or NULL if it has none
+static u8g2arm_setup_t *find_setup(u8x8_t *u8x8)
+{
+  u8g2arm_setup_t *p_setup;
+  if(!is_port_byte_cb(u8x8))
+    return NULL;
+  pthread_mutex_lock(&setup_list_lock);
+  for(p_setup = setup_list; p_setup != NULL; p_setup = p_setup->next)
+    if(p_setup == u8x8_GetUserPtr(u8x8))
+      break;
+  pthread_mutex_unlock(&setup_list_lock);
+  return p_setup;
+}
+
+// GPIO chip of the display, NULL to use the chip shared by the process
+static gpio_chip_t *get_gpio_chip(u8x8_t *u8x8)
+{
+  u8g2arm_setup_t *p_setup = get_setup_ptr(u8x8);
+  if(p_setup == NULL || !is_port_byte_cb(u8x8))
+    return NULL;
+  return p_setup->gpio_chip;
+}
+
+// Start a new run for the held SPI bytes, or reuse the current run if it
+// is empty or already has the requested DC level
+static void spi_set_seg_dc(u8g2arm_setup_t *p_setup, uint8_t dc)
+{
+  spi_seg_t *seg = &p_setup->seg[p_setup->seg_cnt - 1];
+  if(seg->dc == dc)
+    return;
+
+  if(seg->start == p_setup->tx_len)
+    seg->dc = dc;
+  else {
+    seg++;
+    seg->start = p_setup->tx_len;
+    seg->dc = dc;
+    p_setup->seg_cnt++;
+  }
+}
+
+// Send the bytes held by the batched hardware SPI driver. Each run of
+// bytes with one DC level becomes one transfer. The DC line can only be
+// changed between ioctls, so a DC change sends the transfers before it
+// as one SPI_IOC_MESSAGE and a message only holds runs with the same DC
+// level (all runs when the display has no DC pin). CS is kept active
+// while DC changes between messages, and the controller's pre chip
+// disable wait is applied before CS is finally released.
+static void spi_flush(u8x8_t *u8x8)
+{
+  u8g2arm_setup_t *p_setup = get_setup_ptr(u8x8);
+  struct spi_ioc_transfer tr[SPI_TX_MAX_SEGS];
+  spi_seg_t seg[SPI_TX_MAX_SEGS + 1];
+  uint8_t has_dc_pin = (u8x8->pins[U8X8_PIN_DC] != U8X8_PIN_NONE);
+  uint8_t seg_cnt, i, tr_cnt;
+
+  if(p_setup->tx_len == 0)
+    return;
+
+  // take the runs and reset the state before any GPIO callback is made
+  seg_cnt = p_setup->seg_cnt;
+  memcpy(seg, p_setup->seg, seg_cnt * sizeof(spi_seg_t));
+  seg[seg_cnt].start = p_setup->tx_len;
+  p_setup->tx_len = 0;
+  p_setup->seg_cnt = 1;
+  p_setup->seg[0].start = 0;
+  p_setup->seg[0].dc = seg[seg_cnt - 1].dc;
+
+  memset(tr, 0, sizeof(tr));
+  tr_cnt = 0;
+  for(i = 0; i < seg_cnt; i++) {
+    if(seg[i + 1].start == seg[i].start)
+      continue; // empty run
+
+    if(has_dc_pin && seg[i].dc != p_setup->dc_level) {
+      if(tr_cnt) {
+        tr[tr_cnt - 1].cs_change = 1; // hold CS while DC changes
+        SPITransferN(p_setup->dev_fd, tr, tr_cnt);
+        memset(tr, 0, tr_cnt * sizeof(tr[0]));
+        tr_cnt = 0;
+      }
+      u8x8_gpio_SetDC(u8x8, seg[i].dc);
+      p_setup->dc_level = seg[i].dc;
+    }
+
+    tr[tr_cnt].tx_buf = (unsigned long)(p_setup->tx_buf + seg[i].start);
+    tr[tr_cnt].len = seg[i + 1].start - seg[i].start;
+    tr[tr_cnt].speed_hz = p_setup->spi_hz;
+    tr[tr_cnt].bits_per_word = 8;
+    tr_cnt++;
+  }
+
+  if(tr_cnt) {
+    tr[tr_cnt - 1].delay_usecs =
+        (u8x8->display_info->pre_chip_disable_wait_ns + 999) / 1000;
+    SPITransferN(p_setup->dev_fd, tr, tr_cnt);
+  }
+}
+
+// Send the completed I2C messages held by the batched hardware I2C
+// driver with a single I2C_RDWR ioctl. Bytes of a transfer that has not
+// ended yet are moved to the start of the buffer.
+static void i2c_flush(u8x8_t *u8x8)
+{
+  u8g2arm_setup_t *p_setup = get_setup_ptr(u8x8);
+  struct i2c_msg msgs[I2C_TX_MAX_MSGS];
+  uint16_t addr = u8x8_GetI2CAddress(u8x8) >> 1;
+  uint16_t done;
+  uint8_t i;
+
+  if(p_setup->msg_cnt == 0)
+    return;
+
+  for(i = 0; i < p_setup->msg_cnt; i++) {
+    msgs[i].addr = addr;
+    msgs[i].flags = 0;
+    msgs[i].len = p_setup->msg_start[i + 1] - p_setup->msg_start[i];
+    msgs[i].buf = p_setup->tx_buf + p_setup->msg_start[i];
+  }
+  if(I2CWriteMessages(p_setup->dev_fd, msgs, p_setup->msg_cnt) < 0)
+    p_setup->tx_error = 1;
+
+  done = p_setup->msg_start[p_setup->msg_cnt];
+  memmove(p_setup->tx_buf, p_setup->tx_buf + done, p_setup->tx_len - done);
+  p_setup->tx_len -= done;
+  p_setup->msg_start[0] = 0;
+  p_setup->msg_cnt = 0;
+}
+
+// Number of bytes held for the I2C transfer that has not ended yet
+static uint16_t i2c_open_len(u8g2arm_setup_t *p_setup)
+{
+  return p_setup->tx_len - p_setup->msg_start[p_setup->msg_cnt];
+}
+
+// Held bytes must reach the display before a GPIO line changes or a
+// delay starts, so that the order and timing seen by the display are
+// the same as when each byte is sent immediately
+static void flush_pending(u8x8_t *u8x8)
+{
+  if(get_setup_ptr(u8x8) == NULL || !is_port_byte_cb(u8x8))
+    return;
+  if(u8x8->byte_cb == u8x8_byte_arm_linux_hw_spi)
+    spi_flush(u8x8);
+  else if(u8x8->byte_cb == u8x8_byte_arm_linux_hw_i2c)
+    i2c_flush(u8x8);
+}
+
+// Allocate the display details with default settings
+static u8g2arm_setup_t *new_setup(u8x8_t *u8x8)
 {
   u8g2arm_setup_t *p_setup = (u8g2arm_setup_t *)malloc(sizeof(u8g2arm_setup_t));
   u8x8_SetUserPtr(u8x8, p_setup);
+  if(p_setup) {
+    p_setup->gpio_chip = NULL;
+    p_setup->gpio_chip_path[0] = '\0';
+    p_setup->gpio_call_ns = 0;
+    p_setup->dev_name[0] = '\0';
+    p_setup->bus_number = 0;
+    p_setup->cs_number = 0;
+    p_setup->spi_hz = 1000000;
+    p_setup->dev_fd = -1;  // invalid file descriptor
+    p_setup->tx_mode = U8G2ARM_TX_BATCH;
+    p_setup->dc_level = DC_LEVEL_UNKNOWN;
+    p_setup->seg_cnt = 1;
+    p_setup->seg[0].start = 0;
+    p_setup->seg[0].dc = 1;
+    p_setup->i2c_addr = I2C_ADDR_UNKNOWN;
+    p_setup->cad_state = CAD_NONE;
+    p_setup->tx_overflow = 0;
+    p_setup->tx_error = 0;
+    p_setup->msg_cnt = 0;
+    p_setup->msg_start[0] = 0;
+    p_setup->tx_max = TX_BUF_LEN;
+    p_setup->tx_len = 0;
+    pthread_mutex_lock(&setup_list_lock);
+    p_setup->next = setup_list;
+    setup_list = p_setup;
+    pthread_mutex_unlock(&setup_list_lock);
+  }
+  return p_setup;
+}
+
+int u8g2arm_arm_init_hw_spi(u8x8_t *u8x8, int bus_number, int cs_number,
+    int spi_mhz)
+{
+  u8g2arm_setup_t *p_setup;
+  u8g2arm_arm_free(u8x8); // details of a previous init
+  p_setup = new_setup(u8x8);
   if(p_setup) {
     p_setup->bus_number = bus_number;
     p_setup->cs_number = cs_number;
     p_setup->spi_hz = (spi_mhz ? spi_mhz : 1) * 1000000; // default to 1 MHz
-    p_setup->dev_fd = -1;  // invalid file descriptor
   }
   return p_setup != NULL;
 }
 
+int u8g2arm_arm_init_gpio(u8x8_t *u8x8, const char *chip_path)
+{
+  u8g2arm_setup_t *p_setup;
+  char path[GPIO_CHIP_PATH_LEN];
+
+  // the user pointer of a display on another byte driver is the program's
+  if(!is_port_byte_cb(u8x8))
+    return 0;
+  p_setup = find_setup(u8x8);
+  if(p_setup == NULL)
+    p_setup = new_setup(u8x8);
+  if(p_setup == NULL)
+    return 0;
+
+  snprintf(path, GPIO_CHIP_PATH_LEN, "%s", chip_path ? chip_path : "");
+  if(strcmp(path, p_setup->gpio_chip_path) != 0)
+  {
+    // the pins are requested again from the new chip
+    closeGPIOChip(p_setup->gpio_chip);
+    p_setup->gpio_chip = NULL;
+    strcpy(p_setup->gpio_chip_path, path);
+  }
+  return 1;
+}
+
+void u8g2arm_arm_free(u8x8_t *u8x8)
+{
+  u8g2arm_setup_t *p_setup = find_setup(u8x8);
+  u8g2arm_setup_t **pp;
+  if(p_setup == NULL)
+    return;
+
+  pthread_mutex_lock(&setup_list_lock);
+  for(pp = &setup_list; *pp != p_setup; pp = &(*pp)->next)
+    ;
+  *pp = p_setup->next;
+  pthread_mutex_unlock(&setup_list_lock);
+
+  flush_pending(u8x8);
+  if(p_setup->dev_fd >= 0)
+    close(p_setup->dev_fd);
+  closeGPIOChip(p_setup->gpio_chip);
+  free(p_setup);
+  u8x8_SetUserPtr(u8x8, NULL);
+}
+
 int u8g2arm_arm_init_hw_i2c(u8x8_t *u8x8, int bus_number)
 {
-  return u8g2arm_arm_init_hw_spi(u8x8, bus_number, -1, 0);
+  int ret = u8g2arm_arm_init_hw_spi(u8x8, bus_number, -1, 0);
+  if(ret)
+    get_setup_ptr(u8x8)->tx_mode = U8G2ARM_TX_BYTE;
+  return ret;
+}
+
+int u8g2arm_arm_use_linux_i2c_cad(u8x8_t *u8x8)
+{
+  if(u8x8->byte_cb != u8x8_byte_arm_linux_hw_i2c || find_setup(u8x8) == NULL ||
+     (u8x8->cad_cb != u8x8_cad_ssd13xx_i2c &&
+      u8x8->cad_cb != u8x8_cad_ssd13xx_fast_i2c))
+    return 0;
+  u8x8->cad_cb = u8x8_cad_ssd13xx_linux_i2c;
+  return 1;
+}
+
+int u8g2arm_arm_flush(u8x8_t *u8x8)
+{
+  u8g2arm_setup_t *p_setup = get_setup_ptr(u8x8);
+  uint8_t tx_error;
+  if(!is_port_byte_cb(u8x8))
+    return 1; // nothing is held by another byte driver
+  if(p_setup == NULL)
+    return 0;
+  flush_pending(u8x8);
+  tx_error = p_setup->tx_error;
+  p_setup->tx_error = 0;
+  return !tx_error;
+}
+
+int u8g2arm_arm_set_tx_mode(u8x8_t *u8x8, int mode)
+{
+  u8g2arm_setup_t *p_setup = get_setup_ptr(u8x8);
+  if(p_setup == NULL || (mode != U8G2ARM_TX_BYTE && mode != U8G2ARM_TX_BATCH))
+    return 0;
+
+  flush_pending(u8x8);
+  p_setup->tx_mode = mode;
+  p_setup->dc_level = DC_LEVEL_UNKNOWN;
+  return 1;
 }
 
 uint8_t u8x8_arm_linux_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
+    // SPI, 8080 (D0 is SPI clock, D1 is SPI data), control and I2C pins
+    static const uint8_t init_pins[] = {
+        U8X8_PIN_SPI_CLOCK, U8X8_PIN_SPI_DATA, U8X8_PIN_CS,
+        U8X8_PIN_D2, U8X8_PIN_D3, U8X8_PIN_D4, U8X8_PIN_D5, U8X8_PIN_D6,
+        U8X8_PIN_D7, U8X8_PIN_E, U8X8_PIN_RESET, U8X8_PIN_DC,
+        U8X8_PIN_I2C_DATA, U8X8_PIN_I2C_CLOCK };
+    int pins[sizeof(init_pins)];
+    int pin_cnt;
+    unsigned int i;
+    u8g2arm_setup_t *p_setup;
+    gpio_chip_t *chip;
+
     (void) arg_ptr; /* suppress unused parameter warning */
+    // a display without details from an init function may point anywhere
+    if(msg == U8X8_MSG_GPIO_AND_DELAY_INIT && find_setup(u8x8) == NULL)
+        if(is_port_byte_cb(u8x8))
+            u8x8_SetUserPtr(u8x8, NULL);
+    p_setup = is_port_byte_cb(u8x8) ? get_setup_ptr(u8x8) : NULL;
+    chip = get_gpio_chip(u8x8);
+    if(msg != U8X8_MSG_GPIO_AND_DELAY_INIT)
+        flush_pending(u8x8);
+
     switch(msg)
     {
         case U8X8_MSG_DELAY_NANO:            // delay arg_int * 1 nano second
-            sleep_ns(arg_int);
+            // a setup or pulse time between GPIO edges which is no
+            // longer than a GPIO call of the display has already passed
+            if(p_setup == NULL || arg_int > p_setup->gpio_call_ns)
+                delay_ns(arg_int);
             break;
 
         case U8X8_MSG_DELAY_100NANO:        // delay arg_int * 100 nano seconds
-            sleep_ns(arg_int * 100);
+            delay_ns(arg_int * 100);
             break;
 
         case U8X8_MSG_DELAY_10MICRO:        // delay arg_int * 10 micro seconds
-            sleep_us(arg_int * 10);
+            delay_ns(arg_int * 10000);
             break;
 
         case U8X8_MSG_DELAY_MILLI:            // delay arg_int * 1 milli second
@@ -86,11 +440,11 @@ uint8_t u8x8_arm_linux_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int
             // arg_int=1: delay by 5us, arg_int = 4: delay by 1.25us
             if(arg_int == 1)
             {
-                sleep_us(5);
+                delay_ns(5000);
             }
             else if (arg_int == 4)
             {
-                sleep_ns(1250);
+                delay_ns(1250);
             }
             break;
 
@@ -100,98 +454,35 @@ uint8_t u8x8_arm_linux_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int
             // printf("CLK:%d, DATA:%d, CS:%d, RST:%d, DC:%d\n", u8x8->pins[U8X8_PIN_SPI_CLOCK], u8x8->pins[U8X8_PIN_SPI_DATA], u8x8->pins[U8X8_PIN_CS], u8x8->pins[U8X8_PIN_RESET], u8x8->pins[U8X8_PIN_DC]);
             // printf("SDA:%d, SCL:%d\n", u8x8->pins[U8X8_PIN_I2C_DATA], u8x8->pins[U8X8_PIN_I2C_CLOCK]);
 
-	    // SPI Pins
-            if(u8x8->pins[U8X8_PIN_SPI_CLOCK] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_SPI_CLOCK]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_SPI_CLOCK], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_SPI_CLOCK], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_SPI_DATA] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_SPI_DATA]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_SPI_DATA], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_SPI_DATA], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_CS] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_CS]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_CS], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_CS], GPIO_HIGH);
-            }
-
-            // 8080 mode
-            // D0 --> spi clock
-            // D1 --> spi data
-            if(u8x8->pins[U8X8_PIN_D2] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_D2]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_D2], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_D2], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_D3] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_D3]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_D3], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_D3], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_D4] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_D4]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_D4], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_D4], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_D5] != U8X8_PIN_NONE)
+            // Request all the display pins together as outputs set high
+            pin_cnt = 0;
+            for(i = 0; i < sizeof(init_pins); i++)
             {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_D5]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_D5], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_D5], GPIO_HIGH);
+                if(u8x8->pins[init_pins[i]] != U8X8_PIN_NONE)
+                    pins[pin_cnt++] = u8x8->pins[init_pins[i]];
             }
-            if(u8x8->pins[U8X8_PIN_D6] != U8X8_PIN_NONE)
+            // each display with its own details has its own chip
+            if(pin_cnt > 0 && p_setup != NULL && p_setup->gpio_chip == NULL)
             {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_D6]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_D6], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_D6], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_D7] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_D7]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_D7], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_D7], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_E] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_E]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_E], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_E], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_RESET] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_RESET]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_RESET], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_RESET], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_DC] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_DC]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_DC], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_DC], GPIO_HIGH);
+                p_setup->gpio_chip = openGPIOChip(
+                    p_setup->gpio_chip_path[0] ? p_setup->gpio_chip_path : NULL);
+                chip = p_setup->gpio_chip;
             }
+            exportGPIOChipOutputs(chip, pins, pin_cnt, GPIO_HIGH);
 
-            // I2c pins
-            if(u8x8->pins[U8X8_PIN_I2C_DATA] != U8X8_PIN_NONE)
-            {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_I2C_DATA]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_I2C_DATA], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_I2C_DATA], GPIO_HIGH);
-            }
-            if(u8x8->pins[U8X8_PIN_I2C_CLOCK] != U8X8_PIN_NONE)
+            // time the GPIO calls of the display for U8X8_MSG_DELAY_NANO
+            delay_init();
+            if(pin_cnt > 0 && p_setup != NULL)
             {
-                exportGPIOPin(u8x8->pins[U8X8_PIN_I2C_CLOCK]);
-                setGPIODirection(u8x8->pins[U8X8_PIN_I2C_CLOCK], GPIO_OUT);
-                setGPIOValue(u8x8->pins[U8X8_PIN_I2C_CLOCK], GPIO_HIGH);
+                struct timespec t0, t1;
+                setGPIOChipValue(chip, pins[0], GPIO_HIGH); // warm up
+                clock_gettime(CLOCK_MONOTONIC_RAW, &t0);
+                for(i = 0; i < GPIO_TIMING_CALLS; i++)
+                    setGPIOChipValue(chip, pins[0], GPIO_HIGH);
+                clock_gettime(CLOCK_MONOTONIC_RAW, &t1);
+                p_setup->gpio_call_ns = ((t1.tv_sec - t0.tv_sec) * 1000000000L +
+                    t1.tv_nsec - t0.tv_nsec) / GPIO_TIMING_CALLS;
             }
-
             break;
 
         //case U8X8_MSG_GPIO_D0:                // D0 or SPI clock pin: Output level in arg_int
@@ -202,81 +493,81 @@ uint8_t u8x8_arm_linux_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int
 
         case U8X8_MSG_GPIO_D2:                  // D2 pin: Output level in arg_int
 	    if(u8x8->pins[U8X8_PIN_D2] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_D2], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_D2], arg_int);
             break;
 
         case U8X8_MSG_GPIO_D3:                  // D3 pin: Output level in arg_int
 	    if(u8x8->pins[U8X8_PIN_D3] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_D3], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_D3], arg_int);
             break;
 
         case U8X8_MSG_GPIO_D4:                  // D4 pin: Output level in arg_int
 	    if(u8x8->pins[U8X8_PIN_D4] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_D4], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_D4], arg_int);
             break;
 
         case U8X8_MSG_GPIO_D5:                  // D5 pin: Output level in arg_int
 	    if(u8x8->pins[U8X8_PIN_D5] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_D5], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_D5], arg_int);
             break;
 
         case U8X8_MSG_GPIO_D6:                  // D6 pin: Output level in arg_int
 	    if(u8x8->pins[U8X8_PIN_D6] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_D6], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_D6], arg_int);
             break;
 
         case U8X8_MSG_GPIO_D7:                  // D7 pin: Output level in arg_int
 	    if(u8x8->pins[U8X8_PIN_D7] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_D7], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_D7], arg_int);
             break;
 
         case U8X8_MSG_GPIO_E:                   // E/WR pin: Output level in arg_int
 	    if(u8x8->pins[U8X8_PIN_E] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_E], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_E], arg_int);
             break;
 
         case U8X8_MSG_GPIO_I2C_CLOCK:
             // arg_int=0: Output low at I2C clock pin
             // arg_int=1: Input dir with pullup high for I2C clock pin
 	    if(u8x8->pins[U8X8_PIN_I2C_CLOCK] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_I2C_CLOCK], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_I2C_CLOCK], arg_int);
             break;
 
         case U8X8_MSG_GPIO_I2C_DATA:
             // arg_int=0: Output low at I2C data pin
             // arg_int=1: Input dir with pullup high for I2C data pin
 	    if(u8x8->pins[U8X8_PIN_I2C_DATA] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_I2C_DATA], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_I2C_DATA], arg_int);
             break;
 
         case U8X8_MSG_GPIO_SPI_CLOCK:
             //Function to define the logic level of the clockline
 	    if(u8x8->pins[U8X8_PIN_SPI_CLOCK] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_SPI_CLOCK], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_SPI_CLOCK], arg_int);
             break;
 
         case U8X8_MSG_GPIO_SPI_DATA:
             //Function to define the logic level of the data line to the display
 	    if(u8x8->pins[U8X8_PIN_SPI_DATA] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_SPI_DATA], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_SPI_DATA], arg_int);
             break;
 
 	case U8X8_MSG_GPIO_CS:
             // Function to define the logic level of the CS line
 	    if(u8x8->pins[U8X8_PIN_CS] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_CS], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_CS], arg_int);
             break;
 
         case U8X8_MSG_GPIO_DC:
             //Function to define the logic level of the Data/ Command line
 	    if(u8x8->pins[U8X8_PIN_DC] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_DC], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_DC], arg_int);
             break;
 
         case U8X8_MSG_GPIO_RESET:
             //Function to define the logic level of the RESET line
 	    if(u8x8->pins[U8X8_PIN_RESET] != U8X8_PIN_NONE)
-                setGPIOValue(u8x8->pins[U8X8_PIN_RESET], arg_int);
+                setGPIOChipValue(chip, u8x8->pins[U8X8_PIN_RESET], arg_int);
             break;
 
         default:
@@ -287,19 +578,31 @@ uint8_t u8x8_arm_linux_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int
 
 uint8_t u8x8_byte_arm_linux_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
-    /* u8g2/u8x8 will never send more than 32 bytes between START_TRANSFER and END_TRANSFER */
-    static uint8_t buffer[32];
-    static uint8_t buf_idx;
     uint8_t *data;
     u8g2arm_setup_t *p_setup;
+    int addr;
 
     switch(msg)
     {
         case U8X8_MSG_BYTE_SEND:
             data = (uint8_t *)arg_ptr;
+            p_setup = get_setup_ptr(u8x8);
             while( arg_int > 0 )
             {
-                buffer[buf_idx++] = *data;
+                if(p_setup->tx_len >= p_setup->tx_max)
+                {
+                    // make room by sending the completed messages
+                    i2c_flush(u8x8);
+                    if(p_setup->tx_len >= p_setup->tx_max)
+                    {
+                        // a single transfer longer than the buffer cannot
+                        // be split without knowing the controller's
+                        // control bytes, so it is dropped when it ends
+                        p_setup->tx_overflow = 1;
+                        break;
+                    }
+                }
+                p_setup->tx_buf[p_setup->tx_len++] = *data;
                 data++;
                 arg_int--;
             }
@@ -307,21 +610,123 @@ uint8_t u8x8_byte_arm_linux_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
 
         case U8X8_MSG_BYTE_INIT:
             p_setup = get_setup_ptr(u8x8);
-            snprintf(dev_name, DEV_NAME_LEN, "/dev/i2c-%d",
+            snprintf(p_setup->dev_name, DEV_NAME_LEN, "/dev/i2c-%d",
                 p_setup->bus_number);
-            p_setup->dev_fd = openI2CDevice(dev_name);
+            if(p_setup->dev_fd >= 0)
+                close(p_setup->dev_fd); // display initialised again
+            p_setup->dev_fd = openI2CDevice(p_setup->dev_name);
+            p_setup->i2c_addr = I2C_ADDR_UNKNOWN;
             // printf("I2C File Descriptor: %d\n", p_setup->dev_fd);
             break;
 
         case U8X8_MSG_BYTE_START_TRANSFER:
-            setI2CSlave(get_setup_ptr(u8x8)->dev_fd,
-                u8x8_GetI2CAddress(u8x8)>>1);
-            buf_idx = 0;
+            p_setup = get_setup_ptr(u8x8);
+            addr = u8x8_GetI2CAddress(u8x8)>>1;
+            if(addr != p_setup->i2c_addr)
+            {
+                // held messages were queued for the previous address
+                i2c_flush(u8x8);
+                setI2CSlave(p_setup->dev_fd, addr);
+                p_setup->i2c_addr = addr;
+            }
             // printf("I2C Address: %02x\n", u8x8_GetI2CAddress(u8x8)>>1);
             break;
 
         case U8X8_MSG_BYTE_END_TRANSFER:
-            I2CWriteBytes(get_setup_ptr(u8x8)->dev_fd, buffer, buf_idx);
+            p_setup = get_setup_ptr(u8x8);
+            if(p_setup->tx_overflow)
+            {
+                // reported by u8g2arm_arm_flush()
+                p_setup->tx_len = p_setup->msg_start[p_setup->msg_cnt];
+                p_setup->tx_overflow = 0;
+                p_setup->tx_error = 1;
+                break;
+            }
+            if(p_setup->tx_mode == U8G2ARM_TX_BATCH)
+            {
+                // hold the transfer as one message of the next I2C_RDWR
+                p_setup->msg_start[++p_setup->msg_cnt] = p_setup->tx_len;
+                if(p_setup->msg_cnt == I2C_TX_MAX_MSGS)
+                    i2c_flush(u8x8);
+                break;
+            }
+            if(I2CWriteBytes(p_setup->dev_fd, p_setup->tx_buf, p_setup->tx_len) < 0)
+                p_setup->tx_error = 1;
+            p_setup->tx_len = 0;
+            break;
+
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+// SSD13xx I2C CAD for Linux i2c-dev, which has no 32 byte limit on the
+// length of a transfer. A run of commands and arguments is sent in one
+// transfer after a 0x00 control byte, and all the data sent between the
+// start and end of a CAD transfer (e.g. a full page) is sent in one
+// transfer after a 0x40 control byte. Data that does not fit into the
+// transmit buffer is continued in a new transfer, again after 0x40.
+// Displays on another byte driver use u8x8_cad_ssd13xx_fast_i2c.
+uint8_t u8x8_cad_ssd13xx_linux_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    u8g2arm_setup_t *p_setup;
+
+    // only the hardware I2C driver has details with a transmit buffer
+    if(u8x8->byte_cb != u8x8_byte_arm_linux_hw_i2c || get_setup_ptr(u8x8) == NULL)
+        return u8x8_cad_ssd13xx_fast_i2c(u8x8, msg, arg_int, arg_ptr);
+    p_setup = get_setup_ptr(u8x8);
+
+    switch(msg)
+    {
+        case U8X8_MSG_CAD_SEND_CMD:
+            if(p_setup->cad_state != CAD_CMD)
+            {
+                if(p_setup->cad_state != CAD_NONE)
+                    u8x8_byte_EndTransfer(u8x8);
+                u8x8_byte_StartTransfer(u8x8);
+                u8x8_byte_SendByte(u8x8, 0x000); // command stream
+                p_setup->cad_state = CAD_CMD;
+            }
+            u8x8_byte_SendByte(u8x8, arg_int);
+            break;
+
+        case U8X8_MSG_CAD_SEND_ARG:
+            u8x8_byte_SendByte(u8x8, arg_int);
+            break;
+
+        case U8X8_MSG_CAD_SEND_DATA:
+            if(p_setup->cad_state == CAD_DATA &&
+               i2c_open_len(p_setup) + arg_int > p_setup->tx_max)
+            {
+                u8x8_byte_EndTransfer(u8x8);
+                p_setup->cad_state = CAD_NONE;
+            }
+            if(p_setup->cad_state != CAD_DATA)
+            {
+                if(p_setup->cad_state != CAD_NONE)
+                    u8x8_byte_EndTransfer(u8x8);
+                u8x8_byte_StartTransfer(u8x8);
+                u8x8_byte_SendByte(u8x8, 0x040); // data stream
+                p_setup->cad_state = CAD_DATA;
+            }
+            u8x8_byte_SendBytes(u8x8, arg_int, arg_ptr);
+            break;
+
+        case U8X8_MSG_CAD_INIT:
+            // apply default i2c adr so that the start transfer msg can use it
+            if(u8x8->i2c_address == 255)
+                u8x8->i2c_address = 0x078;
+            return u8x8->byte_cb(u8x8, msg, arg_int, arg_ptr);
+
+        case U8X8_MSG_CAD_START_TRANSFER:
+            p_setup->cad_state = CAD_NONE;
+            break;
+
+        case U8X8_MSG_CAD_END_TRANSFER:
+            if(p_setup->cad_state != CAD_NONE)
+                u8x8_byte_EndTransfer(u8x8);
+            p_setup->cad_state = CAD_NONE;
             break;
 
         default:
@@ -344,6 +749,19 @@ uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
             p_setup = get_setup_ptr(u8x8);
             // printf("Buffering Data %d \n", arg_int);
 
+            if(p_setup->tx_mode == U8G2ARM_TX_BATCH)
+            {
+                while( arg_int > 0)
+                {
+                    p_setup->tx_buf[p_setup->tx_len++] = *data;
+                    if(p_setup->tx_len >= p_setup->tx_max)
+                        spi_flush(u8x8);
+                    data++;
+                    arg_int--;
+                }
+                break;
+            }
+
             while( arg_int > 0)
             {
                 // printf("%.2X ", (uint8_t)*data);
@@ -366,7 +784,7 @@ uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
 
         case U8X8_MSG_BYTE_INIT:
             p_setup = get_setup_ptr(u8x8);
-            snprintf(dev_name, DEV_NAME_LEN, "/dev/spidev%d.%d",
+            snprintf(p_setup->dev_name, DEV_NAME_LEN, "/dev/spidev%d.%d",
                 p_setup->bus_number, p_setup->cs_number);
 
             //u8x8_gpio_SetCS(u8x8, u8x8->display_info->chip_disable_level);
@@ -385,12 +803,18 @@ uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
             }
             // printf("SPI Device Mode Set\n");
 
+            if(p_setup->dev_fd >= 0)
+                closeSPIDevice(p_setup->dev_fd); // display initialised again
             p_setup->dev_fd =
-                openSPIDevice(dev_name, internal_spi_mode, 8, p_setup->spi_hz);
+                openSPIDevice(p_setup->dev_name, internal_spi_mode, 8, p_setup->spi_hz);
+            // a single message cannot be larger than the spidev buffer
+            if(getSPIBufSize() < p_setup->tx_max)
+                p_setup->tx_max = getSPIBufSize();
+            p_setup->tx_len = 0;
             /*
             if (p_setup->dev_fd  < 0 )
             {
-                printf("Failed to open SPI Device %s\n", dev_name);
+                printf("Failed to open SPI Device %s\n", p_setup->dev_name);
             }
             else
             {
@@ -400,6 +824,15 @@ uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
             break;
 
         case U8X8_MSG_BYTE_SET_DC:
+            p_setup = get_setup_ptr(u8x8);
+            if(p_setup->tx_mode == U8G2ARM_TX_BATCH)
+            {
+                // queue the DC change with the held bytes
+                if(p_setup->seg_cnt == SPI_TX_MAX_SEGS)
+                    spi_flush(u8x8);
+                spi_set_seg_dc(p_setup, arg_int);
+                break;
+            }
             u8x8_gpio_SetDC(u8x8, arg_int);
             break;
 
@@ -407,6 +840,7 @@ uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
             break;
 
         case U8X8_MSG_BYTE_END_TRANSFER:
+            spi_flush(u8x8);
             break;
 
         default:
@@ -414,3 +848,92 @@ uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
     }
     return 1;
 }
+
+// Bit-banged 4 wire SPI. The data line and the leading clock edge of each
+// bit are set together with a single GPIO call.
+uint8_t u8x8_byte_arm_linux_4wire_sw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    uint8_t i, b;
+    uint8_t *data;
+    uint8_t takeover_edge = u8x8_GetSPIClockPhase(u8x8);
+    int pins[2], values[2];
+    gpio_chip_t *chip = get_gpio_chip(u8x8);
+
+    pins[0] = u8x8->pins[U8X8_PIN_SPI_CLOCK];
+    pins[1] = u8x8->pins[U8X8_PIN_SPI_DATA];
+    if(msg != U8X8_MSG_BYTE_SEND || pins[0] == U8X8_PIN_NONE ||
+       pins[1] == U8X8_PIN_NONE)
+        return u8x8_byte_4wire_sw_spi(u8x8, msg, arg_int, arg_ptr);
+
+    values[0] = 1 - takeover_edge;
+    data = (uint8_t *)arg_ptr;
+    while( arg_int > 0 )
+    {
+        b = *data;
+        data++;
+        arg_int--;
+        for( i = 0; i < 8; i++ )
+        {
+            values[1] = (b & 128) ? GPIO_HIGH : GPIO_LOW;
+            b <<= 1;
+
+            setGPIOChipValues(chip, pins, values, 2);
+            u8x8_gpio_Delay(u8x8, U8X8_MSG_DELAY_NANO, u8x8->display_info->sda_setup_time_ns);
+            setGPIOChipValue(chip, pins[0], takeover_edge);
+            u8x8_gpio_Delay(u8x8, U8X8_MSG_DELAY_NANO, u8x8->display_info->sck_pulse_width_ns);
+        }
+    }
+    return 1;
+}
+
+// 8080 parallel bus. The eight data lines of each byte are set together
+// with a single GPIO call.
+uint8_t u8x8_byte_arm_linux_8bit_8080mode(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    uint8_t i, b;
+    uint8_t *data;
+    uint8_t bits[8];
+    int pins[8], values[8];
+    int pin_cnt = 0;
+    gpio_chip_t *chip = get_gpio_chip(u8x8);
+
+    if(msg != U8X8_MSG_BYTE_SEND)
+        return u8x8_byte_8bit_8080mode(u8x8, msg, arg_int, arg_ptr);
+
+    for( i = 0; i < 8; i++ )
+    {
+        if(u8x8->pins[U8X8_PIN_D0 + i] != U8X8_PIN_NONE)
+        {
+            pins[pin_cnt] = u8x8->pins[U8X8_PIN_D0 + i];
+            bits[pin_cnt] = i;
+            pin_cnt++;
+        }
+    }
+
+    data = (uint8_t *)arg_ptr;
+    while( arg_int > 0 )
+    {
+        b = *data;
+        data++;
+        arg_int--;
+        for( i = 0; i < pin_cnt; i++ )
+            values[i] = (b >> bits[i]) & 1;
+        setGPIOChipValues(chip, pins, values, pin_cnt);
+
+        u8x8_gpio_Delay(u8x8, U8X8_MSG_DELAY_NANO, u8x8->display_info->data_setup_time_ns);
+        u8x8_gpio_call(u8x8, U8X8_MSG_GPIO_E, 0);
+        u8x8_gpio_Delay(u8x8, U8X8_MSG_DELAY_NANO, u8x8->display_info->write_pulse_width_ns);
+        u8x8_gpio_call(u8x8, U8X8_MSG_GPIO_E, 1);
+    }
+    return 1;
+}
+
+uint8_t u8x8_byte_arm_linux_3wire_sw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    return u8x8_byte_3wire_sw_spi(u8x8, msg, arg_int, arg_ptr);
+}
+
+uint8_t u8x8_byte_arm_linux_sw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    return u8x8_byte_sw_i2c(u8x8, msg, arg_int, arg_ptr);
+}
@@ -64,6 +64,8 @@ sed -i 's!#include <Print.h>!!' ${SRC_DIR}/cppsrc/U8g2lib.h
 sed -i 's!void writeBuffer!//void writeBuffer!' ${SRC_DIR}/cppsrc/U8g2lib.h
 sed -i 's!#include "u8g2.h"!#include "../csrc/u8g2.h"!' ${SRC_DIR}/cppsrc/U8g2lib.h
 sed -i 's! : public Print!!' ${SRC_DIR}/cppsrc/U8g2lib.h
+# overwrite with the libu8g2arm version (async send, waitForFlush)
+cp -a ${SETUP_DIR}/files/U8g2lib.h ${SRC_DIR}/cppsrc
 
 sed -i $'s!^int main.*!#include "font_build_inc.c"\\\n\\\nint main_orig(void)!' ${SRC_DIR}/setup/font/build/build.c
 
@@ -56,6 +56,8 @@ static const ControllerSetup::ValueDetails value_details[CS::VAL_LAST]{
     {"bus_number", "bus number"},
     {"cs_number", "CS number"},
     {"spi_mhz", "SPI speed (MHz)"},
+    {"i2c_page", "send a full page per I2C transfer (0: no, 1: yes)"},
+    {"gpio_chip", "GPIO chip number (/dev/gpiochipN)"},
 };
 
 map<string, int> value_name_to_id = {
@@ -78,6 +80,8 @@ map<string, int> value_name_to_id = {
     {"bus_number", CS::VAL_BUS_NUMBER},
     {"cs_number", CS::VAL_CS_NUMBER},
     {"spi_mhz", CS::VAL_SPI_MHZ},
+    {"i2c_page", CS::VAL_I2C_PAGE},
+    {"gpio_chip", CS::VAL_GPIO_CHIP},
 };
 
 int ControllerSetup::get_value_id(const string &value_name)
@@ -129,7 +133,7 @@ static const ControllerSetup::ComDetails com_details[CS::COM_LAST] = {
         "hardware I2C", // desc
         {},             // required
         {CS::VAL_CLOCK, CS::VAL_DATA, CS::VAL_BUS_NUMBER, CS::VAL_I2C_ADDRESS,
-         CS::VAL_RESET, CS::VAL_ROTATION} // optional
+         CS::VAL_I2C_PAGE, CS::VAL_RESET, CS::VAL_ROTATION} // optional
     },
     {
         "8080", // name
@@ -178,6 +182,8 @@ bool ControllerSetup::set_value(int val_type, uint8_t val, string &errmsg)
     errmsg = "invalid value (cannot be 0)";
   else if (val_type == VAL_SPI_MHZ && val == 0)
     errmsg = "invalid value (cannot be 0)";
+  else if (val_type == VAL_I2C_PAGE && val > 1)
+    errmsg = "invalid value (must be 0 or 1)";
   else
     values[val_type] = val;
 
@@ -266,7 +272,8 @@ bool ControllerSetup::check_values(const string &com_name, string &errmsg)
   // check for values set which are not required or optional
   for (int val_type = 0; val_type < VAL_LAST; val_type++) {
     bool required = com_details->values_required.count(val_type);
-    bool optional = com_details->values_optional.count(val_type);
+    bool optional = com_details->values_optional.count(val_type) ||
+                    val_type == VAL_GPIO_CHIP; // all protocols use GPIO
     bool specified = (values[val_type] != U8X8_PIN_NONE);
     if (required && !specified) {
       errmsg = value_details[val_type].id + " value has not been specified";
@@ -285,6 +292,8 @@ bool ControllerSetup::check_values(const string &com_name, string &errmsg)
 
 bool ControllerSetup::init(U8G2 *u8g2, string &errmsg)
 {
+  // free the details of a previous init of the display
+  u8g2arm_arm_free(u8g2->getU8x8());
   u8x8_SetUserPtr(u8g2->getU8x8(), NULL);
   const u8g2_cb_t *rot_funcs[] = {U8G2_R0, U8G2_R1, U8G2_R2, U8G2_R3};
   uint8_t rotation =
@@ -339,6 +348,11 @@ bool ControllerSetup::init(U8G2 *u8g2, string &errmsg)
     uint8_t bus_num =
         (values[VAL_BUS_NUMBER] == U8X8_PIN_NONE) ? 1 : values[VAL_BUS_NUMBER];
     u8g2arm_arm_init_hw_i2c(u8g2->getU8x8(), bus_num);
+    if (values[VAL_I2C_PAGE] == 1 &&
+        !u8g2arm_arm_use_linux_i2c_cad(u8g2->getU8x8())) {
+      errmsg = "i2c_page is not supported by this controller";
+      return false;
+    }
     if (values[VAL_I2C_ADDRESS] != U8X8_PIN_NONE)
       u8g2->setI2CAddress(VAL_I2C_ADDRESS * 2);
   }
@@ -357,6 +371,18 @@ bool ControllerSetup::init(U8G2 *u8g2, string &errmsg)
     return false;
   }
 
+  // Give the display its own GPIO chip (only displays on the port's byte
+  // drivers have details to hold it)
+  string chip_path;
+  if (values[VAL_GPIO_CHIP] != U8X8_PIN_NONE)
+    chip_path = "/dev/gpiochip" + std::to_string(values[VAL_GPIO_CHIP]);
+  if (u8g2arm_arm_is_port_byte_cb(u8g2->getU8x8()) &&
+      !u8g2arm_arm_init_gpio(u8g2->getU8x8(),
+                             chip_path.empty() ? nullptr : chip_path.c_str())) {
+    errmsg = "could not allocate GPIO details";
+    return false;
+  }
+
   return true;
 }
 
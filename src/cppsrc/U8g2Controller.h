@@ -56,6 +56,8 @@ public:
     VAL_BUS_NUMBER,  ///< bus number
     VAL_CS_NUMBER,   ///< CS number
     VAL_SPI_MHZ,     ///< HW SPI speed in MHz
+    VAL_I2C_PAGE,    ///< HW I2C send a full page per transfer (0: no, 1: yes)
+    VAL_GPIO_CHIP,   ///< GPIO chip number (/dev/gpiochipN)
     VAL_LAST         ///< marker for last entry
   };
 
@@ -332,9 +334,10 @@ public:
    *    PROTOCOL OPTIONS
    *
    *    I2C is an alias for HW_I2C, SPI is an alias for 4W_HW_SPI
+   *    All protocols may also take the optional value gpio_chip
    *    HW_I2C - hardware I2C
    *      required:
-   *      optional: rotation,clock,data,reset,i2c_address,bus_number
+   *      optional: rotation,clock,data,reset,i2c_address,bus_number,i2c_page
    *    SW_I2C - software I2C
    *      required: clock,data
    *      optional: rotation,reset,i2c_address
@@ -389,6 +392,9 @@ public:
    *    i2c_address       I2C address (hex 01-fe)
    *    bus_number        bus number
    *    cs_number         CS number
+   *    spi_mhz           SPI speed (MHz)
+   *    i2c_page          send a full page per I2C transfer (0: no, 1: yes)
+   *    gpio_chip         GPIO chip number (/dev/gpiochipN)
    * \param errmsg to return any error message
    * \param separator the separator character
    * \return \c true is the value was set, otherwise \c false and \c errmsg
@@ -53,6 +53,7 @@
 #include "U8x8lib.h"
 
 #include "../csrc/u8g2.h"
+#include "../port/async.h"
 
 class U8G2
 #ifdef ARDUINO
@@ -62,15 +63,22 @@ class U8G2
   protected:
     u8g2_t u8g2;
     u8x8_char_cb cpp_next_cb; /*  the cpp interface has its own decoding function for the Arduino print command */
+    u8g2arm_async_t *async; /* libu8g2arm transmit thread, see beginAsync() */
   public:
     u8g2_uint_t tx, ty;
   
-    U8G2(void) { cpp_next_cb = u8x8_ascii_next; home(); }
+    U8G2(void) : u8g2() { cpp_next_cb = u8x8_ascii_next; async = nullptr; home(); }
+    ~U8G2(void) { endAsync(); }
+
+    /* a copy would share the transmit thread of beginAsync() */
+    U8G2(const U8G2 &) = delete;
+    U8G2 &operator=(const U8G2 &) = delete;
+
     u8x8_t *getU8x8(void) { return u8g2_GetU8x8(&u8g2); }
     u8g2_t *getU8g2(void) { return &u8g2; }
     
     void sendF(const char *fmt, ...) 
-      { va_list va; va_start(va, fmt); u8x8_cad_vsendf(u8g2_GetU8x8(&u8g2), fmt, va); va_end(va); }
+      { waitForFlush(); va_list va; va_start(va, fmt); u8x8_cad_vsendf(u8g2_GetU8x8(&u8g2), fmt, va); va_end(va); }
 
 
     uint32_t getBusClock(void) { return u8g2_GetU8x8(&u8g2)->bus_clock; }
@@ -86,7 +94,7 @@ class U8G2
     uint8_t getCols(void) { return u8x8_GetCols(u8g2_GetU8x8(&u8g2)); }
     uint8_t getRows(void) { return u8x8_GetRows(u8g2_GetU8x8(&u8g2)); }
     void drawTile(uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr) {
-      u8x8_DrawTile(u8g2_GetU8x8(&u8g2), x, y, cnt, tile_ptr); }
+      waitForFlush(); u8x8_DrawTile(u8g2_GetU8x8(&u8g2), x, y, cnt, tile_ptr); }
 
 #ifdef U8X8_WITH_USER_PTR
       void *getUserPtr() { return u8g2_GetUserPtr(&u8g2); }
@@ -113,27 +121,27 @@ class U8G2
     /* return 0 for no event or U8X8_MSG_GPIO_MENU_SELECT, */
     /* U8X8_MSG_GPIO_MENU_NEXT, U8X8_MSG_GPIO_MENU_PREV, */
     /* U8X8_MSG_GPIO_MENU_HOME */
-    uint8_t getMenuEvent(void) { return u8x8_GetMenuEvent(u8g2_GetU8x8(&u8g2)); }
+    uint8_t getMenuEvent(void) { waitForFlush(); return u8x8_GetMenuEvent(u8g2_GetU8x8(&u8g2)); }
 
     void initDisplay(void) {
-      u8g2_InitDisplay(&u8g2); }
+      waitForFlush(); u8g2_InitDisplay(&u8g2); }
       
     /* call initInterface if the uC comes out of deep sleep mode and display is already running */
     /* initInterface is part if initDisplay, do not call both use either initDisplay OR initInterface */       
     void initInterface(void) {          
-      u8g2_InitInterface(&u8g2); }
+      waitForFlush(); u8g2_InitInterface(&u8g2); }
       
     void clearDisplay(void) {
-      u8g2_ClearDisplay(&u8g2); }
+      waitForFlush(); u8g2_ClearDisplay(&u8g2); }
       
     void setPowerSave(uint8_t is_enable) {
-      u8g2_SetPowerSave(&u8g2, is_enable); }
+      waitForFlush(); u8g2_SetPowerSave(&u8g2, is_enable); }
       
     void setFlipMode(uint8_t mode) {
-      u8g2_SetFlipMode(&u8g2, mode); }
+      waitForFlush(); u8g2_SetFlipMode(&u8g2, mode); }
 
     void setContrast(uint8_t value) {
-      u8g2_SetContrast(&u8g2, value); }
+      waitForFlush(); u8g2_SetContrast(&u8g2, value); }
       
     void setDisplayRotation(const u8g2_cb_t *u8g2_cb) {
       u8g2_SetDisplayRotation(&u8g2, u8g2_cb); }
@@ -184,11 +192,23 @@ class U8G2
 
     
     /* u8g2_buffer.c */
-    void sendBuffer(void) { u8g2_SendBuffer(&u8g2); }
+    void sendBuffer(void) {
+      if(async) u8g2arm_arm_async_send_buffer(async); else u8g2_SendBuffer(&u8g2); }
     void clearBuffer(void) { u8g2_ClearBuffer(&u8g2); }    
+
+    /* libu8g2arm: send the buffer of a full buffer (_f) display from a */
+    /* separate thread, call after initDisplay() or begin(). policy is */
+    /* U8G2ARM_ASYNC_BLOCK, U8G2ARM_ASYNC_DROP or U8G2ARM_ASYNC_COALESCE */
+    bool beginAsync(int policy = U8G2ARM_ASYNC_BLOCK) {
+      if(async) return u8g2arm_arm_async_set_policy(async, policy);
+      async = u8g2arm_arm_async_start(&u8g2, policy); return async != nullptr; }
+    void endAsync(void) {
+      u8g2arm_arm_async_stop(async); async = nullptr; }
+    /* wait until the frames passed to sendBuffer() have been sent */
+    void waitForFlush(void) { if(async) u8g2arm_arm_async_wait(async); }
     
-    void firstPage(void) { u8g2_FirstPage(&u8g2); }
-    uint8_t nextPage(void) { return u8g2_NextPage(&u8g2); }
+    void firstPage(void) { waitForFlush(); u8g2_FirstPage(&u8g2); }
+    uint8_t nextPage(void) { waitForFlush(); return u8g2_NextPage(&u8g2); }
     
     #ifdef U8G2_USE_DYNAMIC_ALLOC
     void setBufferPtr(uint8_t *buf) { u8g2_SetBufferPtr(&u8g2, buf); }
@@ -206,11 +226,27 @@ class U8G2
     void setAutoPageClear(uint8_t mode)  { u8g2_SetAutoPageClear(&u8g2, mode); }
     
     void updateDisplayArea(uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th)
-      { u8g2_UpdateDisplayArea(&u8g2, tx, ty, tw, th); }
+      { waitForFlush(); u8g2_UpdateDisplayArea(&u8g2, tx, ty, tw, th); }
     void updateDisplay(void)
-      { u8g2_UpdateDisplay(&u8g2); }
+      { waitForFlush(); u8g2_UpdateDisplay(&u8g2); }
     void refreshDisplay(void)
-      { u8x8_RefreshDisplay(u8g2_GetU8x8(&u8g2)); }
+      { waitForFlush(); u8x8_RefreshDisplay(u8g2_GetU8x8(&u8g2)); }
+
+#ifdef U8G2_WITH_DIRTY_TILES
+    /* libu8g2arm: send only the tiles changed since the last sendDirty() */
+    void setDirtyTileBuffer(uint8_t *buf) { u8g2_SetDirtyTileBuffer(&u8g2, buf); }
+    uint16_t getDirtyTileBufferSize(void) { return u8g2_GetDirtyTileBufferSize(&u8g2); }
+    void markDirtyArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+      { u8g2_MarkDirtyArea(&u8g2, tx, ty, tw, th); }
+    void sendDirty(void) { waitForFlush(); u8g2_SendDirty(&u8g2); }
+#endif
+
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    /* libu8g2arm: send only the tiles that differ from the last sendDiff() */
+    void setShadowBuffer(uint8_t *buf) { u8g2_SetShadowBuffer(&u8g2, buf); }
+    uint16_t getShadowBufferSize(void) { return u8g2_GetShadowBufferSize(&u8g2); }
+    void sendDiff(void) { waitForFlush(); u8g2_SendDiff(&u8g2); }
+#endif
     
 
 
@@ -236,12 +272,16 @@ class U8G2
     /* u8g2_circle.c */
     void drawCircle(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt = U8G2_DRAW_ALL) { u8g2_DrawCircle(&u8g2, x0, y0, rad, opt); }
     void drawDisc(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt = U8G2_DRAW_ALL) { u8g2_DrawDisc(&u8g2, x0, y0, rad, opt); }     
+    void drawArc(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t start, uint8_t end) { u8g2_DrawArc(&u8g2, x0, y0, rad, start, end); }
+    void drawFilledArc(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, u8g2_uint_t rad_in, uint8_t start, uint8_t end) { u8g2_DrawFilledArc(&u8g2, x0, y0, rad, rad_in, start, end); }
     void drawEllipse(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t opt = U8G2_DRAW_ALL) { u8g2_DrawEllipse(&u8g2, x0, y0, rx, ry, opt); }
     void drawFilledEllipse(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t opt = U8G2_DRAW_ALL) { u8g2_DrawFilledEllipse(&u8g2, x0, y0, rx, ry, opt); }    
 
     /* u8g2_line.c */
     void drawLine(u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2) 
       { u8g2_DrawLine(&u8g2, x1, y1, x2, y2); }
+    void drawThickLine(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t w) 
+      { u8g2_DrawThickLine(&u8g2, x0, y0, x1, y1, w); }
 
     /* u8g2_bitmap.c */
     void setBitmapMode(uint8_t is_transparent) 
@@ -252,11 +292,29 @@ class U8G2
       { u8g2_DrawXBM(&u8g2, x, y, w, h, bitmap); }
     void drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
       { u8g2_DrawXBMP(&u8g2, x, y, w, h, bitmap); }
+
+#ifdef U8G2_WITH_SPRITES
+    /* libu8g2arm: bitmaps converted once into the buffer layout, see U8G2SPRITE */
+    uint32_t getSpriteDataSize(u8g2_uint_t w, u8g2_uint_t h) { return u8g2_GetSpriteDataSize(&u8g2, w, h); }
+    bool initSprite(u8g2_sprite_t *sprite, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, uint8_t *data)
+      { return u8g2_InitSprite(&u8g2, sprite, w, h, bitmap, data) != 0; }
+    void drawSprite(u8g2_uint_t x, u8g2_uint_t y, const u8g2_sprite_t *sprite) { u8g2_DrawSprite(&u8g2, x, y, sprite); }
+    void drawSprite(u8g2_uint_t x, u8g2_uint_t y, class U8G2SPRITE &u8g2sprite);
+    /* drawXBM() and drawXBMP() use the cache, NULL to stop */
+    void setSpriteCache(u8g2_sprite_cache_t *cache) { u8g2_SetSpriteCache(&u8g2, cache); }
+#endif
     
     
     /* u8g2_polygon.c */
     void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2) 
       { u8g2_DrawTriangle(&u8g2, x0, y0, x1, y1, x2, y2); }
+    void addPolygonXY(int16_t x, int16_t y) { u8g2_AddPolygonXY(&u8g2, x, y); }
+    void drawPolygon(void) { u8g2_DrawPolygon(&u8g2); }
+#ifdef U8G2_WITH_POLYGON_FILL
+    /* addPolygonXY() and drawPolygon() use pg, which makes them reentrant, NULL to stop */
+    void setPolygon(u8g2_polygon_t *pg) { u8g2_SetPolygon(&u8g2, pg); }
+    void fillPolygon(u8g2_polygon_t *pg) { u8g2_FillPolygon(&u8g2, pg); }
+#endif
       
     /* u8log_u8g2.c */
     void drawLog(u8g2_uint_t x, u8g2_uint_t y, class U8G2LOG &u8g2log);
@@ -264,6 +322,19 @@ class U8G2
     /* u8g2_font.c */
 
     void setFont(const uint8_t  *font) {u8g2_SetFont(&u8g2, font); }
+#ifdef U8G2_WITH_FONT_INDEX
+    /* libu8g2arm: setFont() indexes the glyphs of the font with the cache, NULL to stop */
+    void setFontIndexCache(u8g2_font_index_cache_t *cache) { u8g2_SetFontIndexCache(&u8g2, cache); }
+#endif
+#ifdef U8G2_WITH_GLYPH_CACHE
+    /* libu8g2arm: glyphs are decoded once into the cache, NULL to stop */
+    void setGlyphCache(u8g2_glyph_cache_t *cache) { u8g2_SetGlyphCache(&u8g2, cache); }
+#endif
+#ifdef U8G2_WITH_FONT_METRICS
+    /* libu8g2arm: glyph and string widths are kept in the caches, NULL to stop */
+    void setFontMetricsCache(u8g2_font_metrics_cache_t *cache) { u8g2_SetFontMetricsCache(&u8g2, cache); }
+    void setStrWidthCache(u8g2_str_width_cache_t *cache) { u8g2_SetStrWidthCache(&u8g2, cache); }
+#endif
     void setFontMode(uint8_t  is_transparent) {u8g2_SetFontMode(&u8g2, is_transparent); }
     void setFontDirection(uint8_t dir) {u8g2_SetFontDirection(&u8g2, dir); }
 
@@ -296,6 +367,10 @@ u8g2_uint_t u8g2_GetUTF8Width(u8g2_t *u8g2, const char *str);
       
     u8g2_uint_t getStrWidth(const char *s) { return u8g2_GetStrWidth(&u8g2, s); }
     u8g2_uint_t getUTF8Width(const char *s) { return u8g2_GetUTF8Width(&u8g2, s); }
+#ifdef U8G2_WITH_TEXT_ATOMS
+    /* libu8g2arm: a string rendered once, see U8G2TEXTATOM */
+    u8g2_uint_t drawTextAtom(u8g2_uint_t x, u8g2_uint_t y, class U8G2TEXTATOM &atom);
+#endif
     
     // not required any more, enable UTF8 for print 
     //void printUTF8(const char *s) { tx += u8g2_DrawUTF8(&u8g2, tx, ty, s); }
@@ -368,25 +443,25 @@ uint8_t u8g2_UserInterfaceInputValue(u8g2_t *u8g2, const char *title, const char
 */
 
     uint8_t userInterfaceSelectionList(const char *title, uint8_t start_pos, const char *sl) {
-      return u8g2_UserInterfaceSelectionList(&u8g2, title, start_pos, sl); }
+      waitForFlush(); return u8g2_UserInterfaceSelectionList(&u8g2, title, start_pos, sl); }
     uint8_t userInterfaceMessage(const char *title1, const char *title2, const char *title3, const char *buttons) {
-      return u8g2_UserInterfaceMessage(&u8g2, title1, title2, title3, buttons); }
+      waitForFlush(); return u8g2_UserInterfaceMessage(&u8g2, title1, title2, title3, buttons); }
     uint8_t userInterfaceInputValue(const char *title, const char *pre, uint8_t *value, uint8_t lo, uint8_t hi, uint8_t digits, const char *post) {
-      return u8g2_UserInterfaceInputValue(&u8g2, title, pre, value, lo, hi, digits, post); }
+      waitForFlush(); return u8g2_UserInterfaceInputValue(&u8g2, title, pre, value, lo, hi, digits, post); }
     
 
      /* LiquidCrystal compatible functions */
     void home(void) { tx = 0; ty = 0;  u8x8_utf8_init(u8g2_GetU8x8(&u8g2)); }
     void clear(void) { home(); clearDisplay(); clearBuffer();  }
-    void noDisplay(void) { u8g2_SetPowerSave(&u8g2, 1); }
-    void display(void) { u8g2_SetPowerSave(&u8g2, 0); }
+    void noDisplay(void) { setPowerSave(1); }
+    void display(void) { setPowerSave(0); }
     void setCursor(u8g2_uint_t x, u8g2_uint_t y) { tx = x; ty = y; }
     u8g2_uint_t getCursorX() { return tx; }
     u8g2_uint_t getCursorY() { return ty; }
  
     /* u8glib compatible functions */
-    void sleepOn(void) { u8g2_SetPowerSave(&u8g2, 1); }
-    void sleepOff(void) { u8g2_SetPowerSave(&u8g2, 0); }    
+    void sleepOn(void) { setPowerSave(1); }
+    void sleepOff(void) { setPowerSave(0); }    
     void setColorIndex(uint8_t color_index) { u8g2_SetDrawColor(&u8g2, color_index); }
     uint8_t getColorIndex(void) { return u8g2_GetDrawColor(&u8g2); }
     int8_t getFontAscent(void) { return u8g2_GetAscent(&u8g2); }
@@ -461,6 +536,74 @@ inline void U8G2::drawLog(u8g2_uint_t x, u8g2_uint_t y, class U8G2LOG &u8g2log)
   u8g2_DrawLog(&u8g2, x, y, &(u8g2log.u8log)); 
 }
 
+#ifdef U8G2_WITH_SPRITES
+/* libu8g2arm: a sprite with its data, e.g. uint8_t buf[u8g2.getSpriteDataSize(w, h)] */
+class U8G2SPRITE
+{
+  public:
+    u8g2_sprite_t sprite;
+
+    /* the constructor does nothing, use begin() instead */
+    U8G2SPRITE(void) { }
+
+    /* convert the XBM bitmap for the current rotation of u8g2, again after setDisplayRotation() */
+    bool begin(class U8G2 &u8g2, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, uint8_t *buf) {
+      return u8g2.initSprite(&sprite, w, h, bitmap, buf);
+    }
+
+    u8g2_uint_t getWidth(void) { return sprite.w; }
+    u8g2_uint_t getHeight(void) { return sprite.h; }
+};
+
+/* u8g2_sprite.c */
+inline void U8G2::drawSprite(u8g2_uint_t x, u8g2_uint_t y, class U8G2SPRITE &u8g2sprite)
+{
+  u8g2_DrawSprite(&u8g2, x, y, &(u8g2sprite.sprite));
+}
+#endif
+
+#ifdef U8G2_WITH_TEXT_ATOMS
+/*
+  libu8g2arm: a string rendered with the font, font direction, reference
+  position and font mode of u8g2 at construction, for labels which do
+  not change. The atom owns its data.
+*/
+class U8G2TEXTATOM
+{
+  public:
+    u8g2_text_atom_t atom;
+
+    U8G2TEXTATOM(class U8G2 &u8g2, const char *s, bool is_utf8 = false) {
+      u8g2_t *u = u8g2.getU8g2();
+      uint32_t size = is_utf8 ? u8g2_GetUTF8AtomDataSize(u, s) : u8g2_GetStrAtomDataSize(u, s);
+      data = size > 0 ? new uint8_t[size] : nullptr;
+      if ( is_utf8 )
+        u8g2_InitUTF8Atom(u, &atom, s, data, size);
+      else
+        u8g2_InitStrAtom(u, &atom, s, data, size);
+    }
+    ~U8G2TEXTATOM(void) { delete[] data; }
+
+    U8G2TEXTATOM(const U8G2TEXTATOM &) = delete;
+    U8G2TEXTATOM &operator=(const U8G2TEXTATOM &) = delete;
+
+    /* getStrWidth() or getUTF8Width() of the string, without decoding it */
+    u8g2_uint_t getStrWidth(void) { return u8g2_GetTextAtomWidth(&atom); }
+    /* size of the bounding box of the pixels */
+    u8g2_uint_t getWidth(void) { return u8g2_GetTextAtomBoxWidth(&atom); }
+    u8g2_uint_t getHeight(void) { return u8g2_GetTextAtomBoxHeight(&atom); }
+
+  private:
+    uint8_t *data;
+};
+
+/* u8g2_text_atom.c */
+inline u8g2_uint_t U8G2::drawTextAtom(u8g2_uint_t x, u8g2_uint_t y, class U8G2TEXTATOM &atom)
+{
+  return u8g2_DrawTextAtom(&u8g2, x, y, &(atom.atom));
+}
+#endif
+
 
 /* 
   U8G2_<controller>_<display>_<memory>_<communication> 
@@ -60,29 +60,17 @@ size_t U8X8::write(uint8_t v)
 }
 
 
-extern "C" uint8_t u8x8_byte_arm_linux_3wire_sw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
-{
-  return u8x8_byte_3wire_sw_spi(u8x8, msg,arg_int, arg_ptr);
-}
+// extern "C" uint8_t u8x8_byte_arm_linux_3wire_sw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 
-extern "C" uint8_t u8x8_byte_arm_linux_4wire_sw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
-{
-  return u8x8_byte_4wire_sw_spi(u8x8, msg,arg_int, arg_ptr);
-}
+// extern "C" uint8_t u8x8_byte_arm_linux_4wire_sw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 
 // extern "C" uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 
-extern "C" uint8_t u8x8_byte_arm_linux_sw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSED uint8_t msg, U8X8_UNUSED uint8_t arg_int, U8X8_UNUSED void *arg_ptr)
-{
-    return u8x8_byte_sw_i2c(u8x8, msg,arg_int, arg_ptr);
-}
+// extern "C" uint8_t u8x8_byte_arm_linux_sw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSED uint8_t msg, U8X8_UNUSED uint8_t arg_int, U8X8_UNUSED void *arg_ptr)
 
 // extern "C" uint8_t u8x8_byte_arm_linux_hw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSED uint8_t msg, U8X8_UNUSED uint8_t arg_int, U8X8_UNUSED void *arg_ptr)
 
-extern "C" uint8_t u8x8_byte_arm_linux_8bit_8080mode(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
-{
-  return u8x8_byte_8bit_8080mode(u8x8, msg,arg_int, arg_ptr);
-}
+// extern "C" uint8_t u8x8_byte_arm_linux_8bit_8080mode(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 
 /*
   use U8X8_PIN_NONE as value for "reset", if there is no reset line
@@ -0,0 +1,348 @@
+/*
+
+  u8g2_arc.c (libu8g2arm)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  Arcs, drawn as horizontal and vertical spans.
+
+  Angles have 256 steps for a full circle and go counter-clockwise,
+  starting at 3 o'clock: 0 is right, 64 is up, 128 is left and 192 is
+  down. The arc goes counter-clockwise from start to end, a full circle
+  is drawn if start and end are equal.
+
+*/
+
+#include "u8g2.h"
+
+/* sin(i*pi/128)*16384 for a quarter circle */
+static const uint16_t u8g2_arc_sin_table[65] =
+{
+  0, 402, 804, 1205, 1606, 2006, 2404, 2801, 3196, 3590, 3981, 4370, 4756, 
+  5139, 5520, 5897, 6270, 6639, 7005, 7366, 7723, 8076, 8423, 8765, 9102, 
+  9434, 9760, 10080, 10394, 10702, 11003, 11297, 11585, 11866, 12140, 12406, 
+  12665, 12916, 13160, 13395, 13623, 13842, 14053, 14256, 14449, 14635, 
+  14811, 14978, 15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986, 
+  16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379, 16384
+};
+
+/* sine of the angle, multiplied by 16384 */
+static u8g2_long_t u8g2_arc_sin(uint8_t a)
+{
+  if ( a <= 64 )
+    return u8g2_arc_sin_table[a];
+  if ( a <= 128 )
+    return u8g2_arc_sin_table[128-a];
+  if ( a <= 192 )
+    return -(u8g2_long_t)u8g2_arc_sin_table[a-128];
+  return -(u8g2_long_t)u8g2_arc_sin_table[256-a];
+}
+
+/*
+  The sector from start to end. A pixel at dx, dy from the center (dy
+  downwards) is inside, if it is counter-clockwise from start and
+  clockwise from end. For arcs of more than a half circle, one of both
+  is sufficient.
+*/
+typedef struct u8g2_arc_sector_struct
+{
+  u8g2_long_t start_cos;
+  u8g2_long_t start_sin;
+  u8g2_long_t end_cos;
+  u8g2_long_t end_sin;
+  uint8_t mode;		/* 0: full circle, 1: at most a half circle, 2: more than a half circle */
+} u8g2_arc_sector_t;
+
+static void u8g2_arc_init_sector(u8g2_arc_sector_t *sector, uint8_t start, uint8_t end)
+{
+  uint8_t angle = end - start;
+  sector->start_cos = u8g2_arc_sin(start + 64);
+  sector->start_sin = u8g2_arc_sin(start);
+  sector->end_cos = u8g2_arc_sin(end + 64);
+  sector->end_sin = u8g2_arc_sin(end);
+  if ( angle == 0 )
+    sector->mode = 0;
+  else if ( angle <= 128 )
+    sector->mode = 1;
+  else
+    sector->mode = 2;
+}
+
+/*
+  Draw the pixels of a span which are inside the sector.
+  dir 0: row y0+pos, columns x0+lo .. x0+hi
+  dir 1: column x0+pos, rows y0+lo .. y0+hi
+*/
+static void u8g2_draw_arc_span(u8g2_t *u8g2, const u8g2_arc_sector_t *sector, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_long_t pos, u8g2_long_t lo, u8g2_long_t hi, uint8_t dir)
+{
+  u8g2_long_t lo1, hi1, lo2, hi2;
+  u8g2_uint_t x, y;
+
+  /* the whole span is outside of the visible window */
+  x = x0 + (u8g2_uint_t)pos;
+  y = y0 + (u8g2_uint_t)pos;
+  if ( dir == 0 )
+  {
+    if ( y < u8g2->user_y0 || y >= u8g2->user_y1 )
+      return;
+  }
+  else
+  {
+    if ( x < u8g2->user_x0 || x >= u8g2->user_x1 )
+      return;
+  }
+
+  lo1 = lo;
+  hi1 = hi;
+  if ( sector->mode != 0 )
+  {
+    lo2 = lo;
+    hi2 = hi;
+    if ( dir == 0 )
+    {
+      u8g2_limit_span(-sector->start_sin, -sector->start_cos*pos, &lo1, &hi1);
+      u8g2_limit_span(sector->end_sin, sector->end_cos*pos, &lo2, &hi2);
+    }
+    else
+    {
+      u8g2_limit_span(-sector->start_cos, -sector->start_sin*pos, &lo1, &hi1);
+      u8g2_limit_span(sector->end_cos, sector->end_sin*pos, &lo2, &hi2);
+    }
+    if ( sector->mode == 1 )
+    {
+      /* intersection */
+      if ( lo1 < lo2 )
+	lo1 = lo2;
+      if ( hi1 > hi2 )
+	hi1 = hi2;
+    }
+    else if ( lo2 <= hi2 )
+    {
+      /* union, one or two spans */
+      if ( lo1 > hi1 )
+      {
+	lo1 = lo2;
+	hi1 = hi2;
+      }
+      else if ( lo2 <= hi1+1 && lo1 <= hi2+1 )
+      {
+	if ( lo1 > lo2 )
+	  lo1 = lo2;
+	if ( hi1 < hi2 )
+	  hi1 = hi2;
+      }
+      else
+      {
+	if ( dir == 0 )
+	  u8g2_DrawHVLine(u8g2, x0 + (u8g2_uint_t)lo2, y, hi2-lo2+1, 0);
+	else
+	  u8g2_DrawHVLine(u8g2, x, y0 + (u8g2_uint_t)lo2, hi2-lo2+1, 1);
+      }
+    }
+  }
+  if ( lo1 > hi1 )
+    return;
+  if ( dir == 0 )
+    u8g2_DrawHVLine(u8g2, x0 + (u8g2_uint_t)lo1, y, hi1-lo1+1, 0);
+  else
+    u8g2_DrawHVLine(u8g2, x, y0 + (u8g2_uint_t)lo1, hi1-lo1+1, 1);
+}
+
+/*==============================================*/
+/* Arc */
+
+/*
+  The span a..b of the octant at the distance pos from the center, in
+  all four quadrants. Pixels on the axes are drawn once.
+*/
+static void u8g2_draw_arc_mirrored_span(u8g2_t *u8g2, const u8g2_arc_sector_t *sector, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_long_t pos, u8g2_long_t a, u8g2_long_t b, uint8_t dir)
+{
+  uint8_t side;
+  for( side = 0; side < 2; side++ )
+  {
+    if ( a == 0 )
+    {
+      u8g2_draw_arc_span(u8g2, sector, x0, y0, pos, -b, b, dir);
+    }
+    else
+    {
+      u8g2_draw_arc_span(u8g2, sector, x0, y0, pos, a, b, dir);
+      u8g2_draw_arc_span(u8g2, sector, x0, y0, pos, -b, -a, dir);
+    }
+    if ( pos == 0 )
+      break;
+    pos = -pos;
+  }
+}
+
+/*
+  The points xa..xb, y of the octant from the top of the circle, and
+  their mirror images, see u8g2_draw_circle_run().
+*/
+static void u8g2_draw_arc_run(u8g2_t *u8g2, const u8g2_arc_sector_t *sector, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t xa, u8g2_uint_t xb, u8g2_uint_t y)
+{
+  u8g2_uint_t b;
+
+  b = xb < y ? xb : y;
+  if ( xa <= b )
+    u8g2_draw_arc_mirrored_span(u8g2, sector, x0, y0, y, xa, b, 0);
+  if ( y > 0 )
+  {
+    b = xb < y ? xb : y-1;
+    if ( xa <= b )
+      u8g2_draw_arc_mirrored_span(u8g2, sector, x0, y0, y, xa, b, 1);
+  }
+}
+
+/*
+  The pixels of u8g2_DrawCircle() from angle start to end.
+*/
+void u8g2_DrawArc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t start, uint8_t end)
+{
+  u8g2_arc_sector_t sector;
+  u8g2_int_t f;
+  u8g2_int_t ddF_x;
+  u8g2_int_t ddF_y;
+  u8g2_uint_t x;
+  u8g2_uint_t y;
+  u8g2_uint_t xa, yy;
+
+  /* check for bounding box */
+#ifdef U8G2_WITH_INTERSECTION
+  {
+    if ( u8g2_IsIntersection(u8g2, x0-rad, y0-rad, x0+rad+1, y0+rad+1) == 0 ) 
+      return;
+  }
+#endif /* U8G2_WITH_INTERSECTION */
+
+  u8g2_arc_init_sector(&sector, start, end);
+
+  f = 1;
+  f -= rad;
+  ddF_x = 1;
+  ddF_y = 0;
+  ddF_y -= rad;
+  ddF_y *= 2;
+  x = 0;
+  y = rad;
+  xa = 0;		/* first x of the points with the current y */
+
+  while ( x < y )
+  {
+    yy = y;
+    if (f >= 0) 
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    if ( y != yy )
+    {
+      u8g2_draw_arc_run(u8g2, &sector, x0, y0, xa, x-1, yy);
+      xa = x;
+    }
+  }
+  u8g2_draw_arc_run(u8g2, &sector, x0, y0, xa, x, y);
+}
+
+/*==============================================*/
+/* Filled Arc */
+
+/*
+  A pixel at dx, dy (both >= 0) from the center is set by
+  u8g2_DrawDisc(), if the midpoint circle passes outside of it in its
+  row or column: dx*dx + dy*dy - max(dx, dy) < rad*rad. For rad 0, only
+  the center is set.
+*/
+static uint8_t u8g2_is_in_disc(u8g2_long_t dx, u8g2_long_t dy, u8g2_uint_t rad)
+{
+  u8g2_long_t r2;
+  if ( rad == 0 )
+    return dx == 0 && dy == 0;
+  r2 = rad;
+  r2 *= rad;
+  return dx*dx + dy*dy - (dx > dy ? dx : dy) < r2;
+}
+
+/*
+  The pixels of u8g2_DrawDisc() with radius rad from angle start to
+  end, without the pixels of u8g2_DrawDisc() with radius rad_in-1. With
+  rad_in 0, this is a sector of the disc, with rad_in equal to rad, it
+  is a one pixel wide arc. rad must not exceed 46000.
+*/
+void u8g2_DrawFilledArc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, u8g2_uint_t rad_in, uint8_t start, uint8_t end)
+{
+  u8g2_arc_sector_t sector;
+  u8g2_long_t dy;
+  u8g2_long_t xo, xi;
+  u8g2_long_t pos;
+  uint8_t side;
+
+  /* check for bounding box */
+#ifdef U8G2_WITH_INTERSECTION
+  {
+    if ( u8g2_IsIntersection(u8g2, x0-rad, y0-rad, x0+rad+1, y0+rad+1) == 0 ) 
+      return;
+  }
+#endif /* U8G2_WITH_INTERSECTION */
+
+  if ( rad_in > rad )
+    return;
+  u8g2_arc_init_sector(&sector, start, end);
+
+  xo = rad;		/* last column inside of the disc with rad */
+  xi = rad_in;		/* first column outside of the disc with rad_in-1 */
+  for( dy = 0; dy <= (u8g2_long_t)rad; dy++ )
+  {
+    while ( !u8g2_is_in_disc(xo, dy, rad) )
+      xo--;
+    while ( xi > 0 && !u8g2_is_in_disc(xi-1, dy, rad_in-1) )
+      xi--;
+    if ( xi > xo )
+      continue;
+    pos = dy;
+    for( side = 0; side < 2; side++ )
+    {
+      if ( xi == 0 )
+      {
+	u8g2_draw_arc_span(u8g2, &sector, x0, y0, pos, -xo, xo, 0);
+      }
+      else
+      {
+	u8g2_draw_arc_span(u8g2, &sector, x0, y0, pos, -xo, -xi, 0);
+	u8g2_draw_arc_span(u8g2, &sector, x0, y0, pos, xi, xo, 0);
+      }
+      if ( pos == 0 )
+	break;
+      pos = -pos;
+    }
+  }
+}
@@ -40,6 +40,25 @@ void u8g2_SetBitmapMode(u8g2_t *u8g2, uint8_t is_transparent) {
   u8g2->bitmap_transparency = is_transparent;
 }
 
+/*
+  Draw the w x h bitmap with stride bytes per line at x,y. is_msb_first
+  is 1 if the left pixel of a byte is bit 7, and 0 (XBM) if it is bit 0.
+*/
+void u8g2_draw_bitmap_box(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, u8g2_uint_t stride, uint8_t is_msb_first, const uint8_t *bitmap)
+{
+  u8g2_blit_t blit;
+  blit.bitmap = bitmap;
+  blit.stride = stride;
+  blit.is_msb_first = is_msb_first;
+  blit.sx = 0;
+  blit.sy = 0;
+  blit.dx_x = 1;
+  blit.dy_x = 0;
+  blit.dx_y = 0;
+  blit.dy_y = 1;
+  u8g2_DrawHVBlit(u8g2, x, y, w, h, &blit);
+}
+
 /*
   x,y 	Position on the display
   len		Length of bitmap line in pixel. Note: This differs from u8glib which had a bytecount here.
@@ -49,36 +68,12 @@ void u8g2_SetBitmapMode(u8g2_t *u8g2, uint8_t is_transparent) {
 
 void u8g2_DrawHorizontalBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, const uint8_t *b)
 {
-  uint8_t mask;
-  uint8_t color = u8g2->draw_color;
-  uint8_t ncolor = (color == 0 ? 1 : 0);
-
 #ifdef U8G2_WITH_INTERSECTION
   if ( u8g2_IsIntersection(u8g2, x, y, x+len, y+1) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
   
-  mask = 128;
-  while(len > 0)
-  {
-    if ( *b & mask ) {
-      u8g2->draw_color = color;
-      u8g2_DrawHVLine(u8g2, x, y, 1, 0);
-    } else if ( u8g2->bitmap_transparency == 0 ) {
-      u8g2->draw_color = ncolor;
-      u8g2_DrawHVLine(u8g2, x, y, 1, 0);
-    }
-
-    x++;
-    mask >>= 1;
-    if ( mask == 0 )
-    {
-      mask = 128;
-      b++;
-    }
-    len--;
-  }
-  u8g2->draw_color = color;
+  u8g2_draw_bitmap_box(u8g2, x, y, len, 1, (len+7)>>3, 1, b);
 }
 
 
@@ -93,46 +88,19 @@ void u8g2_DrawBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt
     return;
 #endif /* U8G2_WITH_INTERSECTION */
   
-  while( h > 0 )
-  {
-    u8g2_DrawHorizontalBitmap(u8g2, x, y, w, bitmap);
-    bitmap += cnt;
-    y++;
-    h--;
-  }
+  u8g2_draw_bitmap_box(u8g2, x, y, w, h, cnt, 1, bitmap);
 }
 
 
 
 void u8g2_DrawHXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, const uint8_t *b)
 {
-  uint8_t mask;
-  uint8_t color = u8g2->draw_color;
-  uint8_t ncolor = (color == 0 ? 1 : 0);
 #ifdef U8G2_WITH_INTERSECTION
   if ( u8g2_IsIntersection(u8g2, x, y, x+len, y+1) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
   
-  mask = 1;
-  while(len > 0) {
-    if ( *b & mask ) {
-      u8g2->draw_color = color;
-      u8g2_DrawHVLine(u8g2, x, y, 1, 0);
-    } else if ( u8g2->bitmap_transparency == 0 ) {
-      u8g2->draw_color = ncolor;
-      u8g2_DrawHVLine(u8g2, x, y, 1, 0);
-    }
-    x++;
-    mask <<= 1;
-    if ( mask == 0 )
-    {
-      mask = 1;
-      b++;
-    }
-    len--;
-  }
-  u8g2->draw_color = color;
+  u8g2_draw_bitmap_box(u8g2, x, y, len, 1, (len+7)>>3, 0, b);
 }
 
 
@@ -147,51 +115,31 @@ void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
     return;
 #endif /* U8G2_WITH_INTERSECTION */
   
-  while( h > 0 )
+#ifdef U8G2_WITH_SPRITES
+  if ( u8g2->sprite_cache != NULL )
   {
-    u8g2_DrawHXBM(u8g2, x, y, w, bitmap);
-    bitmap += blen;
-    y++;
-    h--;
+    u8g2_draw_cached_sprite(u8g2, x, y, w, h, bitmap);
+    return;
   }
+#endif /* U8G2_WITH_SPRITES */
+  u8g2_draw_bitmap_box(u8g2, x, y, w, h, blen, 0, bitmap);
 }
 
 
 
-
-
+/*
+  The bitmap is read directly, which requires that PROGMEM data can be
+  read as normal memory (true for the Linux targets of this library).
+*/
 
 void u8g2_DrawHXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, const uint8_t *b)
 {
-  uint8_t mask;
-  uint8_t color = u8g2->draw_color;
-  uint8_t ncolor = (color == 0 ? 1 : 0);
 #ifdef U8G2_WITH_INTERSECTION
   if ( u8g2_IsIntersection(u8g2, x, y, x+len, y+1) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
   
-  mask = 1;
-  while(len > 0)
-  {
-    if( u8x8_pgm_read(b) & mask ) {
-      u8g2->draw_color = color;
-      u8g2_DrawHVLine(u8g2, x, y, 1, 0);
-    } else if( u8g2->bitmap_transparency == 0 ) {
-      u8g2->draw_color = ncolor;
-      u8g2_DrawHVLine(u8g2, x, y, 1, 0);
-    }
-   
-    x++;
-    mask <<= 1;
-    if ( mask == 0 )
-    {
-      mask = 1;
-      b++;
-    }
-    len--;
-  }
-  u8g2->draw_color = color;
+  u8g2_draw_bitmap_box(u8g2, x, y, len, 1, (len+7)>>3, 0, b);
 }
 
 
@@ -206,13 +154,12 @@ void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8
     return;
 #endif /* U8G2_WITH_INTERSECTION */
   
-  while( h > 0 )
+#ifdef U8G2_WITH_SPRITES
+  if ( u8g2->sprite_cache != NULL )
   {
-    u8g2_DrawHXBMP(u8g2, x, y, w, bitmap);
-    bitmap += blen;
-    y++;
-    h--;
+    u8g2_draw_cached_sprite(u8g2, x, y, w, h, bitmap);
+    return;
   }
+#endif /* U8G2_WITH_SPRITES */
+  u8g2_draw_bitmap_box(u8g2, x, y, w, h, blen, 0, bitmap);
 }
-
-
@@ -37,12 +37,57 @@
 #include <string.h>
 
 /*============================================*/
+#ifdef U8G2_WITH_DIRTY_TILES
+/*
+  mark the tiles which are not empty, as they are changed by a clear
+  (a whole tile row is marked for other memory architectures)
+*/
+static void u8g2_mark_dirty_nonempty(u8g2_t *u8g2)
+{
+  uint8_t *ptr = u8g2->tile_buf_ptr;
+  uint8_t w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  uint8_t tx, ty, i;
+  uint16_t j;
+  
+  for( ty = 0; ty < u8g2->tile_buf_height; ty++ )
+  {
+    if ( u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb )
+    {
+      for( tx = 0; tx < w; tx++ )
+      {
+	for( i = 0; i < 8; i++ )
+	  if ( ptr[i] != 0 )
+	  {
+	    u8g2_mark_dirty_tiles(u8g2, tx, ty, tx, ty);
+	    break;
+	  }
+	ptr += 8;
+      }
+    }
+    else
+    {
+      for( j = 0; j < (uint16_t)w*8; j++ )
+	if ( ptr[j] != 0 )
+	{
+	  u8g2_mark_dirty_tiles(u8g2, 0, ty, w-1, ty);
+	  break;
+	}
+      ptr += (uint16_t)w*8;
+    }
+  }
+}
+#endif /* U8G2_WITH_DIRTY_TILES */
+
 void u8g2_ClearBuffer(u8g2_t *u8g2)
 {
   size_t cnt;
   cnt = u8g2_GetU8x8(u8g2)->display_info->tile_width;
   cnt *= u8g2->tile_buf_height;
   cnt *= 8;
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_ptr != NULL )
+    u8g2_mark_dirty_nonempty(u8g2);
+#endif /* U8G2_WITH_DIRTY_TILES */
   memset(u8g2->tile_buf_ptr, 0, cnt);
 }
 
@@ -174,6 +219,254 @@ void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, u
   }  
 }
 
+#ifdef U8G2_WITH_DIRTY_TILES
+/*============================================*/
+/*
+  Description:
+    Assign the dirty tile buffer of u8g2_GetDirtyTileBufferSize(u8g2) bytes,
+    or NULL to turn off dirty tile tracking. All tiles are marked as dirty,
+    so that the next u8g2_SendDirty() will send the complete buffer.
+*/
+void u8g2_SetDirtyTileBuffer(u8g2_t *u8g2, uint8_t *buf)
+{
+  u8g2->dirty_tile_ptr = buf;
+  if ( buf != NULL )
+    memset(buf, 0xff, u8g2_GetDirtyTileBufferSize(u8g2));
+}
+
+/*
+  mark tiles tx0..tx1 of the rows ty0..ty1 (included) of the buffer as dirty
+*/
+void u8g2_mark_dirty_tiles(u8g2_t *u8g2, uint8_t tx0, uint8_t ty0, uint8_t tx1, uint8_t ty1)
+{
+  uint8_t row_size = u8g2_GetDirtyTileRowSize(u8g2);
+  uint8_t *ptr = u8g2->dirty_tile_ptr + (uint16_t)ty0*row_size;
+  uint8_t tx;
+  
+  for(;;)
+  {
+    for( tx = tx0; tx <= tx1; tx++ )
+      ptr[tx>>3] |= 1<<(tx&7);
+    if ( ty0 >= ty1 )
+      break;
+    ty0++;
+    ptr += row_size;
+  }
+}
+
+/*
+  Description:
+    Mark a sub area of the buffer as dirty, e.g. after the buffer was
+    written directly. The arguments are "tile" coordinates, as for
+    u8g2_UpdateDisplayArea(). Nothing is done if tracking is off.
+*/
+void u8g2_MarkDirtyArea(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+{
+  if ( u8g2->dirty_tile_ptr == NULL || tw == 0 || th == 0 )
+    return;
+  u8g2_mark_dirty_tiles(u8g2, tx, ty, tx+tw-1, ty+th-1);
+}
+
+/*
+  Description:
+    Send the runs of dirty tiles in each row of the buffer with
+    u8x8_DrawTile() and then clear the dirty tile buffer. The complete
+    buffer is sent if tracking is off. Displays with another memory
+    architecture than u8g2_ll_hvline_vertical_top_lsb get each row with a
+    dirty tile sent in full.
+*/
+void u8g2_SendDirty(u8g2_t *u8g2)
+{
+  uint8_t *dirty;
+  uint8_t *ptr;
+  uint8_t w, row_size, src_row, dest_row, dest_max;
+  uint16_t tx, run;
+  uint8_t is_sent = 0;
+  
+  dirty = u8g2->dirty_tile_ptr;
+  if ( dirty == NULL )
+  {
+    u8g2_SendBuffer(u8g2);
+    return;
+  }
+  
+  w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  row_size = u8g2_GetDirtyTileRowSize(u8g2);
+  dest_row = u8g2->tile_curr_row;
+  dest_max = u8g2_GetU8x8(u8g2)->display_info->tile_height;
+  ptr = u8g2->tile_buf_ptr;
+  
+  for( src_row = 0; src_row < u8g2->tile_buf_height && dest_row < dest_max; src_row++, dest_row++ )
+  {
+    if ( u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb )
+    {
+      for( tx = 0; tx < row_size; tx++ )
+	if ( dirty[tx] != 0 )
+	  break;
+      if ( tx < row_size )
+      {
+	u8x8_DrawTile(u8g2_GetU8x8(u8g2), 0, dest_row, w, ptr);
+	is_sent = 1;
+      }
+    }
+    else
+    {
+      tx = 0;
+      while( tx < w )
+      {
+	if ( dirty[tx>>3] == 0 )
+	{
+	  tx = (tx | 7) + 1;	/* skip the clean byte */
+	  continue;
+	}
+	if ( (dirty[tx>>3] & (1<<(tx&7))) == 0 )
+	{
+	  tx++;
+	  continue;
+	}
+	run = 1;
+	while( tx+run < w && (dirty[(tx+run)>>3] & (1<<((tx+run)&7))) != 0 )
+	  run++;
+	u8x8_DrawTile(u8g2_GetU8x8(u8g2), tx, dest_row, run, ptr+tx*8);
+	is_sent = 1;
+	tx += run;
+      }
+    }
+    memset(dirty, 0, row_size);
+    dirty += row_size;
+    ptr += (uint16_t)w*8;
+  }
+  
+  if ( is_sent )
+    u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );
+}
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+#ifdef U8G2_WITH_SHADOW_BUFFER
+/*============================================*/
+/*
+  Description:
+    Assign the shadow buffer of u8g2_GetShadowBufferSize(u8g2) bytes, or
+    NULL to stop using it. The next u8g2_SendDiff() will send the complete
+    buffer. Assign the shadow buffer again after the display was written by
+    any other procedure (e.g. u8g2_SendBuffer() or u8g2_ClearDisplay()).
+*/
+void u8g2_SetShadowBuffer(u8g2_t *u8g2, uint8_t *buf)
+{
+  u8g2->shadow_buf_ptr = buf;
+  u8g2->is_shadow_valid = 0;
+}
+
+/* compare two tiles with a single 64 bit compare */
+static uint8_t u8g2_is_tile_equal(const uint8_t *a, const uint8_t *b)
+{
+  uint64_t x, y;
+  memcpy(&x, a, 8);
+  memcpy(&y, b, 8);
+  return x == y;
+}
+
+/* 1 if tile tx of the row differs from the shadow buffer */
+static uint8_t u8g2_is_tile_diff(const uint8_t *dirty, const uint8_t *ptr, const uint8_t *shadow, uint16_t tx)
+{
+  if ( dirty != NULL && (dirty[tx>>3] & (1<<(tx&7))) == 0 )
+    return 0;	/* not changed since the last send */
+  return !u8g2_is_tile_equal(ptr+tx*8, shadow+tx*8);
+}
+
+/*
+  Description:
+    Compare each tile of the buffer with the shadow buffer, send the runs
+    of differing tiles in each row with u8x8_DrawTile() and copy them to
+    the shadow buffer. A single equal tile between two differing tiles is
+    sent with them, as this is cheaper than starting another run. If dirty
+    tile tracking is active, only the dirty tiles are compared, and the
+    dirty tile buffer is cleared.
+    Displays with another memory architecture than
+    u8g2_ll_hvline_vertical_top_lsb get each differing row sent in full.
+*/
+void u8g2_SendDiff(u8g2_t *u8g2)
+{
+  uint8_t *ptr;
+  uint8_t *shadow;
+  uint8_t *dirty = NULL;
+  uint8_t dirty_row_size = 0;
+  uint16_t page_size;
+  uint8_t w, src_row, dest_row, dest_max;
+  uint16_t tx, end, gap;
+  uint8_t is_sent = 0;
+  
+  shadow = u8g2->shadow_buf_ptr;
+  if ( shadow == NULL )
+  {
+    u8g2_SendBuffer(u8g2);
+    return;
+  }
+  
+#ifdef U8G2_WITH_DIRTY_TILES
+  dirty = u8g2->dirty_tile_ptr;
+  dirty_row_size = u8g2_GetDirtyTileRowSize(u8g2);
+#endif /* U8G2_WITH_DIRTY_TILES */
+  w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  page_size = u8g2->pixel_buf_width;  /* 8*tile_width */
+  dest_row = u8g2->tile_curr_row;
+  dest_max = u8g2_GetU8x8(u8g2)->display_info->tile_height;
+  ptr = u8g2->tile_buf_ptr;
+  
+  for( src_row = 0; src_row < u8g2->tile_buf_height && dest_row < dest_max; src_row++, dest_row++ )
+  {
+    if ( u8g2->is_shadow_valid == 0 || u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb )
+    {
+      if ( u8g2->is_shadow_valid == 0 || memcmp(ptr, shadow, page_size) != 0 )
+      {
+	u8x8_DrawTile(u8g2_GetU8x8(u8g2), 0, dest_row, w, ptr);
+	memcpy(shadow, ptr, page_size);
+	is_sent = 1;
+      }
+    }
+    else
+    {
+      tx = 0;
+      while( tx < w )
+      {
+	if ( !u8g2_is_tile_diff(dirty, ptr, shadow, tx) )
+	{
+	  tx++;
+	  continue;
+	}
+	/* extend the run over differing tiles and single equal tiles */
+	end = tx+1;
+	gap = 0;
+	while( end < w && gap <= 1 )
+	{
+	  if ( u8g2_is_tile_diff(dirty, ptr, shadow, end) )
+	    gap = 0;
+	  else
+	    gap++;
+	  end++;
+	}
+	end -= gap;
+	u8x8_DrawTile(u8g2_GetU8x8(u8g2), tx, dest_row, end-tx, ptr+tx*8);
+	memcpy(shadow+tx*8, ptr+tx*8, (end-tx)*8);
+	is_sent = 1;
+	tx = end;
+      }
+    }
+    if ( dirty != NULL )
+    {
+      memset(dirty, 0, dirty_row_size);
+      dirty += dirty_row_size;
+    }
+    ptr += page_size;
+    shadow += page_size;
+  }
+  u8g2->is_shadow_valid = 1;
+  
+  if ( is_sent )
+    u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );
+}
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+
 /* same as sendBuffer, but does not send the ePaper refresh message */
 void u8g2_UpdateDisplay(u8g2_t *u8g2)
 {
@@ -147,14 +147,11 @@ void u8g2_DrawButtonFrame(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_
     {
       if ( border_width == (flags & U8G2_BTN_BW_MASK) )
       {
-        u8g2_uint_t i;
         u8g2_uint_t shadow_gap = (flags & U8G2_BTN_SHADOW_MASK) >> U8G2_BTN_SHADOW_POS;
         shadow_gap--;
-        for( i = 0; i < border_width; i++ )
-        {
-          u8g2_DrawHLine(u8g2, xx+border_width+shadow_gap,yy+hh+i+shadow_gap,ww);
-          u8g2_DrawVLine(u8g2, xx+ww+i+shadow_gap,yy+border_width+shadow_gap,hh);
-        }
+        /* the border_width lines below and right of the button, as two boxes */
+        u8g2_DrawBox(u8g2, xx+border_width+shadow_gap,yy+hh+shadow_gap,ww,border_width);
+        u8g2_DrawBox(u8g2, xx+ww+shadow_gap,yy+border_width+shadow_gap,border_width,hh);
       }
     }
     border_width--;
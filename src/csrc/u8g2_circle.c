@@ -35,40 +35,170 @@
 
 #include "u8g2.h"
 
+
 /*==============================================*/
-/* Circle */
+/* Spans */
 
-static void u8g2_draw_circle_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option) U8G2_NOINLINE;
+/*
+  The shapes below compute one quadrant and pass it as spans to the
+  following two procedures, which mirror the spans into the quadrants
+  selected by option. Each pixel is drawn once, including the pixels on
+  the axes, which belong to two or four quadrants: this keeps XOR (draw
+  color 2) correct and avoids drawing the same pixels several times.
+*/
+
+/*
+  Draw a span of an outline.
+  dir 0: row pos (distance from y0), columns a..b (distance from x0)
+  dir 1: column pos (distance from x0), rows a..b (distance from y0)
+*/
+static void u8g2_draw_circle_span(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t pos, u8g2_uint_t a, u8g2_uint_t b, uint8_t dir, uint8_t option) U8G2_NOINLINE;
 
-static void u8g2_draw_circle_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
+static void u8g2_draw_circle_span(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t pos, u8g2_uint_t a, u8g2_uint_t b, uint8_t dir, uint8_t option)
 {
-    /* upper right */
-    if ( option & U8G2_DRAW_UPPER_RIGHT )
+  uint8_t q[4];		/* quadrants of the minus side (towards lower, higher along) and the plus side */
+  u8g2_uint_t across, along;
+  u8g2_uint_t c, start, len;
+  uint8_t side, lo, hi;
+
+  q[0] = U8G2_DRAW_UPPER_LEFT;
+  q[3] = U8G2_DRAW_LOWER_RIGHT;
+  if ( dir == 0 )
+  {
+    q[1] = U8G2_DRAW_UPPER_RIGHT;
+    q[2] = U8G2_DRAW_LOWER_LEFT;
+    across = y0;
+    along = x0;
+  }
+  else
+  {
+    q[1] = U8G2_DRAW_LOWER_LEFT;
+    q[2] = U8G2_DRAW_UPPER_RIGHT;
+    across = x0;
+    along = y0;
+  }
+  if ( pos == 0 )
+  {
+    /* the span is on the axis, both sides are the same */
+    q[0] |= q[2];
+    q[1] |= q[3];
+    q[2] = 0;
+    q[3] = 0;
+  }
+
+  for( side = 0; side < 2; side++ )
+  {
+    c = side == 0 ? across - pos : across + pos;
+    lo = option & q[side*2];
+    hi = option & q[side*2+1];
+    if ( lo != 0 && hi != 0 && a == 0 )
     {
-      u8g2_DrawPixel(u8g2, x0 + x, y0 - y);
-      u8g2_DrawPixel(u8g2, x0 + y, y0 - x);
+      /* both halves meet on the axis */
+      start = along - b;
+      len = b;
+      len *= 2;
+      len++;
+      if ( dir == 0 )
+	u8g2_DrawHVLine(u8g2, start, c, len, 0);
+      else
+	u8g2_DrawHVLine(u8g2, c, start, len, 1);
+      continue;
     }
-    
-    /* upper left */
-    if ( option & U8G2_DRAW_UPPER_LEFT )
+    len = b - a + 1;
+    if ( hi != 0 )
     {
-      u8g2_DrawPixel(u8g2, x0 - x, y0 - y);
-      u8g2_DrawPixel(u8g2, x0 - y, y0 - x);
+      start = along + a;
+      if ( dir == 0 )
+	u8g2_DrawHVLine(u8g2, start, c, len, 0);
+      else
+	u8g2_DrawHVLine(u8g2, c, start, len, 1);
     }
-    
-    /* lower right */
-    if ( option & U8G2_DRAW_LOWER_RIGHT )
+    if ( lo != 0 )
     {
-      u8g2_DrawPixel(u8g2, x0 + x, y0 + y);
-      u8g2_DrawPixel(u8g2, x0 + y, y0 + x);
+      start = along - b;
+      if ( dir == 0 )
+	u8g2_DrawHVLine(u8g2, start, c, len, 0);
+      else
+	u8g2_DrawHVLine(u8g2, c, start, len, 1);
     }
-    
-    /* lower left */
-    if ( option & U8G2_DRAW_LOWER_LEFT )
+  }
+}
+
+/*
+  Number of rows from y0-h (upper quadrant) to y0+h (lower quadrant),
+  y is the first row.
+*/
+static u8g2_uint_t u8g2_get_disc_rows(u8g2_uint_t y0, u8g2_uint_t h, uint8_t is_upper, uint8_t is_lower, u8g2_uint_t *y)
+{
+  *y = is_upper ? y0 - h : y0;
+  if ( is_upper && is_lower )
+    return 2*h+1;
+  if ( is_upper || is_lower )
+    return h+1;
+  return 0;
+}
+
+/*
+  Fill the columns a..b (distance from x0) from row y0-h to y0+h.
+*/
+static void u8g2_draw_disc_span(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t a, u8g2_uint_t b, u8g2_uint_t h, uint8_t option) U8G2_NOINLINE;
+
+static void u8g2_draw_disc_span(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t a, u8g2_uint_t b, u8g2_uint_t h, uint8_t option)
+{
+  uint8_t ul = (option & U8G2_DRAW_UPPER_LEFT) != 0;
+  uint8_t ur = (option & U8G2_DRAW_UPPER_RIGHT) != 0;
+  uint8_t ll = (option & U8G2_DRAW_LOWER_LEFT) != 0;
+  uint8_t lr = (option & U8G2_DRAW_LOWER_RIGHT) != 0;
+  u8g2_uint_t y, rows;
+
+  if ( a == 0 )
+  {
+    rows = u8g2_get_disc_rows(y0, h, ul|ur, ll|lr, &y);
+    if ( ul == ur && ll == lr )
     {
-      u8g2_DrawPixel(u8g2, x0 - x, y0 + y);
-      u8g2_DrawPixel(u8g2, x0 - y, y0 + x);
+      /* left and right half are the same, draw a single box */
+      if ( rows > 0 )
+	u8g2_DrawBox(u8g2, x0-b, y, 2*b+1, rows);
+      return;
     }
+    /* column x0 belongs to both halves */
+    if ( rows > 0 )
+      u8g2_DrawBox(u8g2, x0, y, 1, rows);
+    if ( b == 0 )
+      return;
+    a = 1;
+  }
+  rows = u8g2_get_disc_rows(y0, h, ur, lr, &y);
+  if ( rows > 0 )
+    u8g2_DrawBox(u8g2, x0+a, y, b-a+1, rows);
+  rows = u8g2_get_disc_rows(y0, h, ul, ll, &y);
+  if ( rows > 0 )
+    u8g2_DrawBox(u8g2, x0-b, y, b-a+1, rows);
+}
+
+/*==============================================*/
+/* Circle */
+
+/*
+  The points xa..xb, y of the octant from the top of the circle
+  (x <= y), and their mirror image at the diagonal, which is the octant
+  next to the horizontal axis. Points on the diagonal are drawn once,
+  the last point (below the diagonal) is the mirror image of the point
+  before it.
+*/
+static void u8g2_draw_circle_run(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t xa, u8g2_uint_t xb, u8g2_uint_t y, uint8_t option)
+{
+  u8g2_uint_t b;
+
+  b = xb < y ? xb : y;
+  if ( xa <= b )
+    u8g2_draw_circle_span(u8g2, x0, y0, y, xa, b, 0, option);
+  if ( y > 0 )
+  {
+    b = xb < y ? xb : y-1;
+    if ( xa <= b )
+      u8g2_draw_circle_span(u8g2, x0, y0, y, xa, b, 1, option);
+  }
 }
 
 static void u8g2_draw_circle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
@@ -78,6 +208,7 @@ static void u8g2_draw_circle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_
     u8g2_int_t ddF_y;
     u8g2_uint_t x;
     u8g2_uint_t y;
+    u8g2_uint_t xa, yy;
 
     f = 1;
     f -= rad;
@@ -87,11 +218,11 @@ static void u8g2_draw_circle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_
     ddF_y *= 2;
     x = 0;
     y = rad;
+    xa = 0;		/* first x of the points with the current y */
 
-    u8g2_draw_circle_section(u8g2, x, y, x0, y0, option);
-    
     while ( x < y )
     {
+      yy = y;
       if (f >= 0) 
       {
         y--;
@@ -102,8 +233,13 @@ static void u8g2_draw_circle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_
       ddF_x += 2;
       f += ddF_x;
 
-      u8g2_draw_circle_section(u8g2, x, y, x0, y0, option);    
+      if ( y != yy )
+      {
+	u8g2_draw_circle_run(u8g2, x0, y0, xa, x-1, yy, option);
+	xa = x;
+      }
     }
+    u8g2_draw_circle_run(u8g2, x0, y0, xa, x, y, option);
 }
 
 void u8g2_DrawCircle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
@@ -124,37 +260,19 @@ void u8g2_DrawCircle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t r
 /*==============================================*/
 /* Disk */
 
-static void u8g2_draw_disc_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option) U8G2_NOINLINE;
-
-static void u8g2_draw_disc_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
+/*
+  The columns below the points xa..xb, y of u8g2_draw_circle_run(), and
+  the column below their mirror image, unless it is one of these columns.
+*/
+static void u8g2_draw_disc_run(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t xa, u8g2_uint_t xb, u8g2_uint_t y, uint8_t option)
 {
-    /* upper right */
-    if ( option & U8G2_DRAW_UPPER_RIGHT )
-    {
-      u8g2_DrawVLine(u8g2, x0+x, y0-y, y+1);
-      u8g2_DrawVLine(u8g2, x0+y, y0-x, x+1);
-    }
-    
-    /* upper left */
-    if ( option & U8G2_DRAW_UPPER_LEFT )
-    {
-      u8g2_DrawVLine(u8g2, x0-x, y0-y, y+1);
-      u8g2_DrawVLine(u8g2, x0-y, y0-x, x+1);
-    }
-    
-    /* lower right */
-    if ( option & U8G2_DRAW_LOWER_RIGHT )
-    {
-      u8g2_DrawVLine(u8g2, x0+x, y0, y+1);
-      u8g2_DrawVLine(u8g2, x0+y, y0, x+1);
-    }
-    
-    /* lower left */
-    if ( option & U8G2_DRAW_LOWER_LEFT )
-    {
-      u8g2_DrawVLine(u8g2, x0-x, y0, y+1);
-      u8g2_DrawVLine(u8g2, x0-y, y0, x+1);
-    }
+  u8g2_uint_t b;
+
+  b = xb < y ? xb : y;
+  if ( xa <= b )
+    u8g2_draw_disc_span(u8g2, x0, y0, xa, b, y, option);
+  if ( xb < y )
+    u8g2_draw_disc_span(u8g2, x0, y0, y, y, xb, option);
 }
 
 static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
@@ -164,6 +282,7 @@ static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_ui
   u8g2_int_t ddF_y;
   u8g2_uint_t x;
   u8g2_uint_t y;
+  u8g2_uint_t xa, yy;
 
   f = 1;
   f -= rad;
@@ -173,11 +292,11 @@ static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_ui
   ddF_y *= 2;
   x = 0;
   y = rad;
+  xa = 0;		/* first x of the points with the current y */
 
-  u8g2_draw_disc_section(u8g2, x, y, x0, y0, option);
-  
   while ( x < y )
   {
+    yy = y;
     if (f >= 0) 
     {
       y--;
@@ -188,8 +307,13 @@ static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_ui
     ddF_x += 2;
     f += ddF_x;
 
-    u8g2_draw_disc_section(u8g2, x, y, x0, y0, option);    
+    if ( y != yy )
+    {
+      u8g2_draw_disc_run(u8g2, x0, y0, xa, x-1, yy, option);
+      xa = x;
+    }
   }
+  u8g2_draw_disc_run(u8g2, x0, y0, xa, x, y, option);
 }
 
 void u8g2_DrawDisc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
@@ -212,38 +336,23 @@ void u8g2_DrawDisc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad
 /*
   Source: 
     Foley, Computer Graphics, p 90
+
+  The quadrant is computed from both ends: from (rx,0), one point per
+  row, and from (0,ry), one point per column, until the slope is -1.
+  The points are collected into vertical (first part) and horizontal
+  (second part) spans. Both parts may end on the same point.
+  Requires rx > 0 and ry > 0.
 */
-static void u8g2_draw_ellipse_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option) U8G2_NOINLINE;
-static void u8g2_draw_ellipse_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
-{
-    /* upper right */
-    if ( option & U8G2_DRAW_UPPER_RIGHT )
-    {
-      u8g2_DrawPixel(u8g2, x0 + x, y0 - y);
-    }
-    
-    /* upper left */
-    if ( option & U8G2_DRAW_UPPER_LEFT )
-    {
-      u8g2_DrawPixel(u8g2, x0 - x, y0 - y);
-    }
-    
-    /* lower right */
-    if ( option & U8G2_DRAW_LOWER_RIGHT )
-    {
-      u8g2_DrawPixel(u8g2, x0 + x, y0 + y);
-    }
-    
-    /* lower left */
-    if ( option & U8G2_DRAW_LOWER_LEFT )
-    {
-      u8g2_DrawPixel(u8g2, x0 - x, y0 + y);
-    }
-}
+typedef void (*u8g2_ellipse_span_cb)(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t pos, u8g2_uint_t a, u8g2_uint_t b, uint8_t dir, uint8_t option);
 
-static void u8g2_draw_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
+/*
+  Part from (rx,0): vertical spans with the rows ya..yb in column x.
+  The last span is returned in *x, *ya, *yb instead of being drawn.
+*/
+static void u8g2_draw_ellipse_part1(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option, u8g2_ellipse_span_cb span_cb, u8g2_uint_t *px, u8g2_uint_t *pya, u8g2_uint_t *pyb)
 {
   u8g2_uint_t x, y;
+  u8g2_uint_t run_x, ya, yb;
   u8g2_long_t xchg, ychg;
   u8g2_long_t err;
   u8g2_long_t rxrx2;
@@ -276,9 +385,18 @@ static void u8g2_draw_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2
   stopx *= rx;
   stopy = 0;
   
+  run_x = x;
+  ya = y;
+  yb = y;
   while( stopx >= stopy )
   {
-    u8g2_draw_ellipse_section(u8g2, x, y, x0, y0, option);
+    if ( x != run_x )
+    {
+      span_cb(u8g2, x0, y0, run_x, ya, yb, 1, option);
+      run_x = x;
+      ya = y;
+    }
+    yb = y;
     y++;
     stopy += rxrx2;
     err += ychg;
@@ -291,7 +409,33 @@ static void u8g2_draw_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2
       xchg += ryry2;      
     }
   }
+  *px = run_x;
+  *pya = ya;
+  *pyb = yb;
+}
 
+/*
+  Part from (0,ry): horizontal spans with the columns xa..xb in row y.
+  The last span is returned in *y, *xa, *xb instead of being drawn.
+*/
+static void u8g2_draw_ellipse_part2(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option, u8g2_ellipse_span_cb span_cb, u8g2_uint_t *py, u8g2_uint_t *pxa, u8g2_uint_t *pxb)
+{
+  u8g2_uint_t x, y;
+  u8g2_uint_t run_y, xa, xb;
+  u8g2_long_t xchg, ychg;
+  u8g2_long_t err;
+  u8g2_long_t rxrx2;
+  u8g2_long_t ryry2;
+  u8g2_long_t stopx, stopy;
+  
+  rxrx2 = rx;
+  rxrx2 *= rx;
+  rxrx2 *= 2;
+  
+  ryry2 = ry;
+  ryry2 *= ry;
+  ryry2 *= 2;
+  
   x = 0;
   y = ry;
   
@@ -311,10 +455,18 @@ static void u8g2_draw_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2
   stopy = rxrx2;
   stopy *= ry;
   
-
+  run_y = y;
+  xa = x;
+  xb = x;
   while( stopx <= stopy )
   {
-    u8g2_draw_ellipse_section(u8g2, x, y, x0, y0, option);
+    if ( y != run_y )
+    {
+      span_cb(u8g2, x0, y0, run_y, xa, xb, 0, option);
+      run_y = y;
+      xa = x;
+    }
+    xb = x;
     x++;
     stopx += ryry2;
     err += xchg;
@@ -327,7 +479,39 @@ static void u8g2_draw_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2
       ychg += rxrx2;
     }
   }
-  
+  *py = run_y;
+  *pxa = xa;
+  *pxb = xb;
+}
+
+static void u8g2_draw_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
+{
+  u8g2_uint_t x1, ya, yb;
+  u8g2_uint_t y2, xa, xb;
+
+  /* a flat ellipse is a line */
+  if ( ry == 0 )
+  {
+    u8g2_draw_circle_span(u8g2, x0, y0, 0, 0, rx, 0, option);
+    return;
+  }
+  if ( rx == 0 )
+  {
+    u8g2_draw_circle_span(u8g2, x0, y0, 0, 0, ry, 1, option);
+    return;
+  }
+
+  u8g2_draw_ellipse_part1(u8g2, x0, y0, rx, ry, option, u8g2_draw_circle_span, &x1, &ya, &yb);
+  u8g2_draw_ellipse_part2(u8g2, x0, y0, rx, ry, option, u8g2_draw_circle_span, &y2, &xa, &xb);
+  u8g2_draw_circle_span(u8g2, x0, y0, y2, xa, xb, 0, option);
+  /* skip the last point of the first part, if it is the last point of the second part */
+  if ( x1 == xb && yb == y2 )
+  {
+    if ( ya == yb )
+      return;
+    yb--;
+  }
+  u8g2_draw_circle_span(u8g2, x0, y0, x1, ya, yb, 1, option);
 }
 
 void u8g2_DrawEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
@@ -346,121 +530,50 @@ void u8g2_DrawEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t
 /*==============================================*/
 /* Filled Ellipse */
 
-static void u8g2_draw_filled_ellipse_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option) U8G2_NOINLINE;
-static void u8g2_draw_filled_ellipse_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
+/*
+  Fill below the spans of the ellipse parts: below a horizontal span,
+  all its columns have the height of its row, below a vertical span,
+  the column has the height of its last row.
+*/
+static void u8g2_draw_filled_ellipse_span(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t pos, u8g2_uint_t a, u8g2_uint_t b, uint8_t dir, uint8_t option)
 {
-    /* upper right */
-    if ( option & U8G2_DRAW_UPPER_RIGHT )
-    {
-      u8g2_DrawVLine(u8g2, x0+x, y0-y, y+1);
-    }
-    
-    /* upper left */
-    if ( option & U8G2_DRAW_UPPER_LEFT )
-    {
-      u8g2_DrawVLine(u8g2, x0-x, y0-y, y+1);
-    }
-    
-    /* lower right */
-    if ( option & U8G2_DRAW_LOWER_RIGHT )
-    {
-      u8g2_DrawVLine(u8g2, x0+x, y0, y+1);
-    }
-    
-    /* lower left */
-    if ( option & U8G2_DRAW_LOWER_LEFT )
-    {
-      u8g2_DrawVLine(u8g2, x0-x, y0, y+1);
-    }
+  if ( dir == 0 )
+    u8g2_draw_disc_span(u8g2, x0, y0, a, b, pos, option);
+  else
+    u8g2_draw_disc_span(u8g2, x0, y0, pos, pos, b, option);
 }
 
 static void u8g2_draw_filled_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
 {
-  u8g2_uint_t x, y;
-  u8g2_long_t xchg, ychg;
-  u8g2_long_t err;
-  u8g2_long_t rxrx2;
-  u8g2_long_t ryry2;
-  u8g2_long_t stopx, stopy;
-  
-  rxrx2 = rx;
-  rxrx2 *= rx;
-  rxrx2 *= 2;
-  
-  ryry2 = ry;
-  ryry2 *= ry;
-  ryry2 *= 2;
-  
-  x = rx;
-  y = 0;
-  
-  xchg = 1;
-  xchg -= rx;
-  xchg -= rx;
-  xchg *= ry;
-  xchg *= ry;
-  
-  ychg = rx;
-  ychg *= rx;
-  
-  err = 0;
-  
-  stopx = ryry2;
-  stopx *= rx;
-  stopy = 0;
-  
-  while( stopx >= stopy )
+  u8g2_uint_t x1, ya, yb;
+  u8g2_uint_t y2, xa, xb;
+
+  /* a flat ellipse is a line */
+  if ( ry == 0 || rx == 0 )
   {
-    u8g2_draw_filled_ellipse_section(u8g2, x, y, x0, y0, option);
-    y++;
-    stopy += rxrx2;
-    err += ychg;
-    ychg += rxrx2;
-    if ( 2*err+xchg > 0 )
-    {
-      x--;
-      stopx -= ryry2;
-      err += xchg;
-      xchg += ryry2;      
-    }
+    u8g2_draw_disc_span(u8g2, x0, y0, 0, rx, ry, option);
+    return;
   }
 
-  x = 0;
-  y = ry;
-  
-  xchg = ry;
-  xchg *= ry;
-  
-  ychg = 1;
-  ychg -= ry;
-  ychg -= ry;
-  ychg *= rx;
-  ychg *= rx;
-  
-  err = 0;
-  
-  stopx = 0;
-
-  stopy = rxrx2;
-  stopy *= ry;
-  
-
-  while( stopx <= stopy )
+  u8g2_draw_ellipse_part1(u8g2, x0, y0, rx, ry, option, u8g2_draw_filled_ellipse_span, &x1, &ya, &yb);
+  u8g2_draw_ellipse_part2(u8g2, x0, y0, rx, ry, option, u8g2_draw_filled_ellipse_span, &y2, &xa, &xb);
+  if ( x1 == xb )
   {
-    u8g2_draw_filled_ellipse_section(u8g2, x, y, x0, y0, option);
-    x++;
-    stopx += ryry2;
-    err += xchg;
-    xchg += ryry2;
-    if ( 2*err+ychg > 0 )
+    /* both parts end in the same column, fill it to the higher one */
+    if ( yb > y2 )
     {
-      y--;
-      stopy -= rxrx2;
-      err += ychg;
-      ychg += rxrx2;
+      if ( xa < xb )
+	u8g2_draw_disc_span(u8g2, x0, y0, xa, xb-1, y2, option);
+      u8g2_draw_disc_span(u8g2, x0, y0, xb, xb, yb, option);
+    }
+    else
+    {
+      u8g2_draw_disc_span(u8g2, x0, y0, xa, xb, y2, option);
     }
+    return;
   }
-  
+  u8g2_draw_disc_span(u8g2, x0, y0, xa, xb, y2, option);
+  u8g2_draw_disc_span(u8g2, x0, y0, x1, x1, yb, option);
 }
 
 void u8g2_DrawFilledEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
@@ -475,5 +588,3 @@ void u8g2_DrawFilledEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_u
   
   u8g2_draw_filled_ellipse(u8g2, x0, y0, rx, ry, option);
 }
-
-
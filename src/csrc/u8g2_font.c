@@ -34,10 +34,7 @@
 */
 
 #include "u8g2.h"
-
-/* size of the font data structure, there is no struct or class... */
-/* this is the size for the new font format */
-#define U8G2_FONT_DATA_STRUCT_SIZE 23
+#include <string.h>
 
 /*
   font data:
@@ -502,6 +499,92 @@ static void u8g2_font_setup_decode(u8g2_t *u8g2, const uint8_t *glyph_data)
 }
 
 
+#ifdef U8G2_WITH_FAST_FONT_DECODE
+
+#ifdef __GNUC__
+#define U8G2_ALWAYS_INLINE __inline__ __attribute__((always_inline))
+#else
+#define U8G2_ALWAYS_INLINE
+#endif
+
+#if UINTPTR_MAX > 0xffffffffUL
+typedef uint64_t u8g2_font_bits_t;
+#else
+typedef uint32_t u8g2_font_bits_t;
+#endif
+
+/*
+  The run length code of a glyph, read through a register sized bit
+  buffer: bit 0 of buf is the next bit of the glyph, as returned by
+  u8g2_font_decode_get_unsigned_bits(). Bytes are only loaded up to the
+  end of the glyph data; bits beyond it are read as 0.
+*/
+struct u8g2_font_bit_reader_struct
+{
+  const uint8_t *ptr;		/* next byte to load */
+  const uint8_t *end;
+  u8g2_font_bits_t buf;
+  uint8_t cnt;			/* bits in buf */
+};
+
+static void u8g2_font_bits_refill(struct u8g2_font_bit_reader_struct *r)
+{
+  u8g2_font_bits_t w;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  if ( r->ptr + sizeof(w) <= r->end )
+  {
+    /* unaligned load of a word, the bits above the whole bytes are loaded again with the next word */
+    memcpy(&w, r->ptr, sizeof(w));
+    r->buf |= w << r->cnt;
+    r->ptr += (sizeof(w)*8 - 1 - r->cnt) >> 3;
+    r->cnt |= sizeof(w)*8 - 8;
+    return;
+  }
+#endif
+  while( r->cnt <= sizeof(w)*8 - 8 && r->ptr < r->end )
+  {
+    w = u8x8_pgm_read( r->ptr );
+    r->buf |= w << r->cnt;
+    r->ptr++;
+    r->cnt += 8;
+  }
+}
+
+/* Continue after the glyph header, which has been read with u8g2_font_decode_get_unsigned_bits() */
+static void u8g2_font_bits_init(struct u8g2_font_bit_reader_struct *r, u8g2_t *u8g2, const uint8_t *glyph_data)
+{
+  const u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  uint8_t header_len = 2;
+  /* the glyphs above 255 follow start_pos_unicode and have a 3 byte header (2 bytes encoding, 1 byte size) */
+  if ( glyph_data >= u8g2->font + U8G2_FONT_DATA_STRUCT_SIZE + u8g2->font_info.start_pos_unicode )
+    header_len = 3;
+  /* the byte before the glyph data is the size of the glyph, including the header */
+  r->end = glyph_data - header_len + u8x8_pgm_read( glyph_data - 1 );
+  r->ptr = decode->decode_ptr;
+  r->buf = 0;
+  r->cnt = 0;
+  u8g2_font_bits_refill(r);
+  r->buf >>= decode->decode_bit_pos;
+  r->cnt = r->cnt > decode->decode_bit_pos ? r->cnt - decode->decode_bit_pos : 0;
+}
+
+static U8G2_ALWAYS_INLINE uint8_t u8g2_font_bits_get_unsigned(struct u8g2_font_bit_reader_struct *r, uint8_t cnt)
+{
+  uint8_t val;
+  if ( r->cnt < cnt )
+  {
+    u8g2_font_bits_refill(r);
+    if ( r->cnt < cnt )
+      r->cnt = cnt;		/* end of the glyph data */
+  }
+  val = (uint8_t)(r->buf & ((1U<<cnt)-1));
+  r->buf >>= cnt;
+  r->cnt -= cnt;
+  return val;
+}
+
+#endif /* U8G2_WITH_FAST_FONT_DECODE */
+
 /*
   Description:
     Decode and draw a glyph.
@@ -596,6 +679,27 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
     decode->y = 0;
     
     /* decode glyph */
+#ifdef U8G2_WITH_FAST_FONT_DECODE
+    {
+      struct u8g2_font_bit_reader_struct r;
+      uint8_t bits_per_0 = u8g2->font_info.bits_per_0;
+      uint8_t bits_per_1 = u8g2->font_info.bits_per_1;
+      u8g2_font_bits_init(&r, u8g2, glyph_data);
+      for(;;)
+      {
+	a = u8g2_font_bits_get_unsigned(&r, bits_per_0);
+	b = u8g2_font_bits_get_unsigned(&r, bits_per_1);
+	do
+	{
+	  u8g2_font_decode_len(u8g2, a, 0);
+	  u8g2_font_decode_len(u8g2, b, 1);
+	} while( u8g2_font_bits_get_unsigned(&r, 1) != 0 );
+
+	if ( decode->y >= h )
+	  break;
+      }
+    }
+#else
     for(;;)
     {
       a = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_0);
@@ -609,6 +713,7 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
       if ( decode->y >= h )
 	break;
     }
+#endif /* U8G2_WITH_FAST_FONT_DECODE */
     
     /* restore the u8g2 draw color, because this is modified by the decode algo */
     u8g2->draw_color = decode->fg_color;
@@ -616,6 +721,160 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
   return d;
 }
 
+/*
+  Description:
+    Read the header of a glyph into header and prepare decode for
+    u8g2_font_decode_glyph_xbm(). u8g2->font_decode is not changed.
+*/
+void u8g2_font_read_glyph_header(u8g2_t *u8g2, u8g2_font_decode_t *decode, const uint8_t *glyph_data, u8g2_glyph_header_t *header)
+{
+  decode->decode_ptr = glyph_data;
+  decode->decode_bit_pos = 0;
+  header->w = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_char_width);
+  header->h = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_char_height);
+  header->x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_x);
+  header->y = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_y);
+  header->d = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_delta_x);
+  decode->glyph_width = header->w;
+  decode->glyph_height = header->h;
+}
+
+#ifdef U8G2_WITH_SPRITES
+
+/*
+  Description:
+    The box of the pixels of a glyph in direction dir, as
+    u8g2_font_decode_glyph() places the glyph at x,y.
+  Args:
+    bx, by	upper left corner of the box
+    bw, bh	width and height of the box
+*/
+void u8g2_font_get_glyph_box(const u8g2_glyph_header_t *header, uint8_t dir, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t *bx, u8g2_uint_t *by, u8g2_uint_t *bw, u8g2_uint_t *bh)
+{
+#ifdef U8G2_WITH_FONT_ROTATION
+  x = u8g2_add_vector_x(x, header->x, -(header->h+header->y), dir);
+  y = u8g2_add_vector_y(y, header->x, -(header->h+header->y), dir);
+#else
+  x += header->x;
+  y -= header->h+header->y;
+#endif
+  *bw = header->w;
+  *bh = header->h;
+  if ( dir == 1 )
+  {
+    x -= header->h - 1;
+    *bw = header->h;
+    *bh = header->w;
+  }
+  else if ( dir == 2 )
+  {
+    x -= header->w - 1;
+    y -= header->h - 1;
+  }
+  else if ( dir == 3 )
+  {
+    y -= header->w - 1;
+    *bw = header->h;
+    *bh = header->w;
+  }
+  *bx = x;
+  *by = y;
+}
+
+/* Set the pixels of a run within the glyph, as u8g2_font_decode_len() draws it */
+static void u8g2_font_decode_len_xbm(u8g2_font_decode_t *decode, uint8_t len, uint8_t is_foreground, uint8_t *bitmap, u8g2_uint_t stride, u8g2_uint_t bx, u8g2_uint_t by, uint8_t dir)
+{
+  uint8_t cnt = len;
+  uint8_t rem;
+  uint8_t current;
+  uint8_t lx = decode->x;
+  uint8_t ly = decode->y;
+  uint8_t w = decode->glyph_width;
+  uint8_t h = decode->glyph_height;
+  u8g2_uint_t px, py;
+  uint8_t i;
+
+  for(;;)
+  {
+    rem = w;
+    rem -= lx;
+    current = rem;
+    if ( cnt < rem )
+      current = cnt;
+
+    if ( is_foreground && ly < h )
+    {
+      for( i = lx; i < lx + current; i++ )
+      {
+	switch(dir)
+	{
+	  case 0:
+	    px = i;
+	    py = ly;
+	    break;
+	  case 1:
+	    px = h - 1 - ly;
+	    py = i;
+	    break;
+	  case 2:
+	    px = w - 1 - i;
+	    py = h - 1 - ly;
+	    break;
+	  default:
+	    px = ly;
+	    py = w - 1 - i;
+	    break;
+	}
+	px += bx;
+	py += by;
+	bitmap[(uint32_t)py*stride + (px>>3)] |= 1 << (px&7);
+      }
+    }
+
+    if ( cnt < rem )
+      break;
+    cnt -= rem;
+    lx = 0;
+    ly++;
+  }
+  lx += cnt;
+
+  decode->x = lx;
+  decode->y = ly;
+}
+
+/*
+  Description:
+    Decode a glyph in direction dir into an XBM bitmap with stride bytes
+    per line. The pixels are set (or-ed) in the box at bx,by, see
+    u8g2_font_get_glyph_box(), other pixels are not changed.
+  Args:
+    decode, header	as set by u8g2_font_read_glyph_header()
+*/
+void u8g2_font_decode_glyph_xbm(u8g2_t *u8g2, u8g2_font_decode_t *decode, const u8g2_glyph_header_t *header, uint8_t *bitmap, u8g2_uint_t stride, u8g2_uint_t bx, u8g2_uint_t by, uint8_t dir)
+{
+  uint8_t a, b;
+
+  if ( header->w == 0 )
+    return;
+  decode->x = 0;
+  decode->y = 0;
+  for(;;)
+  {
+    a = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_0);
+    b = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_1);
+    do
+    {
+      u8g2_font_decode_len_xbm(decode, a, 0, bitmap, stride, bx, by, dir);
+      u8g2_font_decode_len_xbm(decode, b, 1, bitmap, stride, bx, by, dir);
+    } while( u8g2_font_decode_get_unsigned_bits(decode, 1) != 0 );
+
+    if ( decode->y >= header->h )
+      break;
+  }
+}
+#endif /* U8G2_WITH_SPRITES */
+
 /*
   Description:
     Find the starting point of the glyph data.
@@ -627,6 +886,16 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
 const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding)
 {
   const uint8_t *font = u8g2->font;
+  
+#ifdef U8G2_WITH_FONT_INDEX
+  if ( u8g2->font_index != NULL && u8g2->font_index->font == font )
+  {
+    const uint8_t *glyph_data;
+    if ( u8g2_font_index_get_glyph_data(u8g2->font_index, encoding, &glyph_data) != 0 )
+      return glyph_data;
+  }
+#endif /* U8G2_WITH_FONT_INDEX */
+  
   font += U8G2_FONT_DATA_STRUCT_SIZE;
 
   
@@ -718,6 +987,10 @@ static u8g2_uint_t u8g2_font_draw_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t
   u8g2->font_decode.target_y = y;
   //u8g2->font_decode.is_transparent = is_transparent; this is already set
   //u8g2->font_decode.dir = dir;
+#ifdef U8G2_WITH_GLYPH_CACHE
+  if ( u8g2->glyph_cache != NULL )
+    return u8g2_draw_cached_glyph(u8g2, x, y, encoding);
+#endif /* U8G2_WITH_GLYPH_CACHE */
   const uint8_t *glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
   if ( glyph_data != NULL )
   {
@@ -739,7 +1012,24 @@ uint8_t u8g2_IsGlyph(u8g2_t *u8g2, uint16_t requested_encoding)
 /* side effect: updates u8g2->font_decode and u8g2->glyph_x_offset */
 int8_t u8g2_GetGlyphWidth(u8g2_t *u8g2, uint16_t requested_encoding)
 {
-  const uint8_t *glyph_data = u8g2_font_get_glyph_data(u8g2, requested_encoding);
+  const uint8_t *glyph_data;
+#ifdef U8G2_WITH_FONT_METRICS
+  const u8g2_glyph_metrics_t *metrics;
+  if ( u8g2->font_metrics_cache != NULL )
+  {
+    metrics = u8g2_font_get_glyph_metrics(u8g2, requested_encoding);
+    if ( metrics != NULL )
+    {
+      if ( metrics->state != U8G2_GLYPH_METRICS_GLYPH )
+	return 0;
+      u8g2->font_decode.glyph_width = metrics->w;
+      u8g2->font_decode.glyph_height = metrics->h;
+      u8g2->glyph_x_offset = metrics->x;
+      return metrics->d;
+    }
+  }
+#endif /* U8G2_WITH_FONT_METRICS */
+  glyph_data = u8g2_font_get_glyph_data(u8g2, requested_encoding);
   if ( glyph_data == NULL )
     return 0; 
   
@@ -1080,6 +1370,10 @@ void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font)
     u8g2_read_font_info(&(u8g2->font_info), font);
     u8g2_UpdateRefHeight(u8g2);
     /* u8g2_SetFontPosBaseline(u8g2); */ /* removed with issue 195 */
+#ifdef U8G2_WITH_FONT_INDEX
+    if ( u8g2->font_index_cache != NULL )
+      u8g2_select_font_index(u8g2);
+#endif /* U8G2_WITH_FONT_INDEX */
   }
 }
 
@@ -1113,8 +1407,7 @@ uint8_t u8g2_IsAllValidUTF8(u8g2_t *u8g2, const char *str)
 
 
 /* string calculation is stilll not 100% perfect as it addes the initial string offset to the overall size */
-static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str) U8G2_NOINLINE;
-static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
+u8g2_uint_t u8g2_font_calc_str_width(u8g2_t *u8g2, const char *str)
 {
   uint16_t e;
   u8g2_uint_t  w, dx;
@@ -1169,6 +1462,16 @@ static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
   return w;  
 }
 
+static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str) U8G2_NOINLINE;
+static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
+{
+#ifdef U8G2_WITH_FONT_METRICS
+  if ( u8g2->str_width_cache != NULL )
+    return u8g2_get_cached_str_width(u8g2, str);
+#endif /* U8G2_WITH_FONT_METRICS */
+  return u8g2_font_calc_str_width(u8g2, str);
+}
+
 static void u8g2_GetGlyphHorizontalProperties(u8g2_t *u8g2, uint16_t requested_encoding, uint8_t *w, int8_t *ox, int8_t *dx)
 {
   const uint8_t *glyph_data = u8g2_font_get_glyph_data(u8g2, requested_encoding);
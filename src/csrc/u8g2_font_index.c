@@ -0,0 +1,252 @@
+/*
+
+  u8g2_font_index.c (libu8g2arm)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  Font index: the glyph data of each glyph of a font, found without
+  walking the glyph list.
+
+  u8g2_font_get_glyph_data() searches the list of glyphs 0 to 255 from
+  'A' or 'a', and the glyphs above 255 from the last entry of the unicode
+  lookup table below the encoding, which may be hundreds of glyphs for
+  the large unicode fonts. With an index, glyphs 0 to 255 are found in a
+  table, and the glyphs above 255 by a binary search within the block of
+  256 encodings, which is at most 9 steps.
+
+  The font index cache keeps the indexes of the most recently used fonts,
+  so that switching between fonts does not index them again. Fonts are
+  identified by their address. All memory is provided by the caller.
+
+*/
+
+#include "u8g2.h"
+
+#ifdef U8G2_WITH_FONT_INDEX
+
+#ifdef U8G2_WITH_UNICODE
+static uint16_t u8g2_font_index_get_word(const uint8_t *p)
+{
+  uint16_t w;
+  w = u8x8_pgm_read( p );
+  w <<= 8;
+  w |= u8x8_pgm_read( p + 1 );
+  return w;
+}
+
+/* first glyph above 255, the list ends with encoding 0 */
+static const uint8_t *u8g2_font_index_get_unicode_glyphs(const uint8_t *font)
+{
+  const uint8_t *unicode_lookup_table;
+  unicode_lookup_table = font + U8G2_FONT_DATA_STRUCT_SIZE + u8g2_font_index_get_word(font + 21);
+  return unicode_lookup_table + u8g2_font_index_get_word(unicode_lookup_table);
+}
+#endif /* U8G2_WITH_UNICODE */
+
+/* Number of unicode offsets which a slot needs to index the font */
+uint32_t u8g2_GetFontIndexSize(const uint8_t *font)
+{
+  uint32_t cnt = 0;
+#ifdef U8G2_WITH_UNICODE
+  const uint8_t *glyph = u8g2_font_index_get_unicode_glyphs(font);
+  while ( u8g2_font_index_get_word(glyph) != 0 )
+  {
+    cnt++;
+    glyph += u8x8_pgm_read( glyph + 2 );
+  }
+#else
+  (void)font;
+#endif /* U8G2_WITH_UNICODE */
+  return cnt;
+}
+
+/*
+  The cache has cnt indexes, each with slot_size offsets in data, which
+  must have cnt*slot_size entries. Fonts with more glyphs above 255 than
+  slot_size are only indexed for the glyphs 0 to 255.
+*/
+void u8g2_InitFontIndexCache(u8g2_font_index_cache_t *cache, u8g2_font_index_t *indexes, uint16_t cnt, uint32_t *data, uint32_t slot_size)
+{
+  cache->indexes = indexes;
+  cache->data = data;
+  cache->cnt = cnt;
+  cache->slot_size = slot_size;
+  u8g2_ClearFontIndexCache(cache);
+}
+
+/* Remove all indexes and reset the counters */
+void u8g2_ClearFontIndexCache(u8g2_font_index_cache_t *cache)
+{
+  uint16_t i;
+  for( i = 0; i < cache->cnt; i++ )
+  {
+    cache->indexes[i].font = NULL;
+    cache->indexes[i].last_use = 0;
+  }
+  cache->clock = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+}
+
+/* Use the cache for u8g2_SetFont() and index the current font, NULL to stop */
+void u8g2_SetFontIndexCache(u8g2_t *u8g2, u8g2_font_index_cache_t *cache)
+{
+  u8g2->font_index_cache = cache;
+  u8g2->font_index = NULL;
+  if ( cache != NULL && u8g2->font != NULL )
+    u8g2_select_font_index(u8g2);
+}
+
+/* Index u8g2->font, which must be set up with u8g2_SetFont() */
+static void u8g2_font_index_build(u8g2_t *u8g2, u8g2_font_index_t *index)
+{
+  const uint8_t *font = u8g2->font;
+  const uint8_t *glyph_data;
+  uint16_t e;
+#ifdef U8G2_WITH_UNICODE
+  const uint8_t *glyph;
+  uint32_t cnt;
+  uint16_t block;
+#endif /* U8G2_WITH_UNICODE */
+
+  /* the glyph list from 'A' and 'a' may differ from the full list, so use the search of each glyph */
+  for( e = 0; e < 256; e++ )
+  {
+    glyph_data = u8g2_font_get_glyph_data(u8g2, e);
+    index->ascii[e] = glyph_data == NULL ? 0 : (uint32_t)(glyph_data - font);
+  }
+
+#ifdef U8G2_WITH_UNICODE
+  glyph = u8g2_font_index_get_unicode_glyphs(font);
+  cnt = 0;
+  block = 0;
+  for(;;)
+  {
+    e = u8g2_font_index_get_word(glyph);
+    if ( e == 0 )
+      break;
+    while( block <= (e >> 8) )
+      index->block[block++] = cnt;
+    if ( cnt < index->unicode_size )
+      index->unicode[cnt] = (uint32_t)(glyph - font);
+    cnt++;
+    glyph += u8x8_pgm_read( glyph + 2 );
+  }
+  while( block <= 256 )
+    index->block[block++] = cnt;
+  index->unicode_cnt = cnt;
+#else
+  index->unicode_cnt = 0;
+#endif /* U8G2_WITH_UNICODE */
+
+  index->font = font;
+}
+
+/*
+  Called by u8g2_SetFont(): find the index of the new font in the cache,
+  or index it in the least recently used slot.
+*/
+void u8g2_select_font_index(u8g2_t *u8g2)
+{
+  u8g2_font_index_cache_t *cache = u8g2->font_index_cache;
+  u8g2_font_index_t *index;
+  u8g2_font_index_t *lru = NULL;
+  uint16_t i;
+
+  u8g2->font_index = NULL;
+  cache->clock++;
+  for( i = 0; i < cache->cnt; i++ )
+  {
+    index = cache->indexes + i;
+    if ( index->font == u8g2->font )
+    {
+      cache->hits++;
+      index->last_use = cache->clock;
+      u8g2->font_index = index;
+      return;
+    }
+    if ( lru == NULL || index->last_use < lru->last_use )
+      lru = index;
+  }
+
+  if ( lru == NULL )
+    return;
+  cache->misses++;
+  lru->font = NULL;		/* not used by u8g2_font_get_glyph_data() while it is built */
+  lru->unicode = cache->data + (uint32_t)(lru - cache->indexes)*cache->slot_size;
+  lru->unicode_size = cache->slot_size;
+  u8g2_font_index_build(u8g2, lru);
+  lru->last_use = cache->clock;
+  u8g2->font_index = lru;
+}
+
+/*
+  Set glyph_data to the glyph data of the encoding, as returned by
+  u8g2_font_get_glyph_data(), or NULL if the glyph is not in the font.
+  Returns 0 if the glyph has to be searched in the font, because the
+  glyphs above 255 did not fit into the slot.
+*/
+uint8_t u8g2_font_index_get_glyph_data(const u8g2_font_index_t *index, uint16_t encoding, const uint8_t **glyph_data)
+{
+#ifdef U8G2_WITH_UNICODE
+  uint32_t lo, hi, mid;
+  uint16_t e;
+  const uint8_t *glyph;
+#endif /* U8G2_WITH_UNICODE */
+
+  *glyph_data = NULL;
+  if ( encoding <= 255 )
+  {
+    if ( index->ascii[encoding] != 0 )
+      *glyph_data = index->font + index->ascii[encoding];
+    return 1;
+  }
+#ifdef U8G2_WITH_UNICODE
+  if ( index->unicode_cnt > index->unicode_size )
+    return 0;
+  lo = index->block[encoding >> 8];
+  hi = index->block[(encoding >> 8) + 1];
+  while( lo < hi )
+  {
+    mid = (lo + hi) >> 1;
+    glyph = index->font + index->unicode[mid];
+    e = u8g2_font_index_get_word(glyph);
+    if ( e == encoding )
+    {
+      *glyph_data = glyph + 3;	/* skip encoding and glyph size */
+      return 1;
+    }
+    if ( e < encoding )
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+#endif /* U8G2_WITH_UNICODE */
+  return 1;
+}
+
+#endif /* U8G2_WITH_FONT_INDEX */
@@ -0,0 +1,284 @@
+/*
+
+  u8g2_font_metrics.c (libu8g2arm)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  Font metrics: glyph and string widths without reading the glyphs.
+
+  u8g2_GetGlyphWidth() searches the glyph and reads its header, and
+  u8g2_GetStrWidth() and u8g2_GetUTF8Width() do this for each glyph of
+  the string, each time a string is measured for centering or layout.
+
+  The font metrics cache keeps a table of the width, height, x offset
+  and delta x of the glyphs 0 to 255 for the most recently used fonts.
+  The table of a font is selected when a glyph of the font is measured,
+  and each glyph is read from the font when it is first measured.
+
+  The string width cache keeps the widths of recently measured strings,
+  keyed by font, char procedure (ASCII or UTF-8) and the characters of
+  the string, which are kept in the cache, so that a string may change
+  in place. All memory is provided by the caller.
+
+*/
+
+#include "u8g2.h"
+#include <string.h>
+
+#ifdef U8G2_WITH_FONT_METRICS
+
+/* The cache has cnt tables */
+void u8g2_InitFontMetricsCache(u8g2_font_metrics_cache_t *cache, u8g2_font_metrics_t *tables, uint16_t cnt)
+{
+  cache->tables = tables;
+  cache->cnt = cnt;
+  u8g2_ClearFontMetricsCache(cache);
+}
+
+/* Remove all tables and reset the counters */
+void u8g2_ClearFontMetricsCache(u8g2_font_metrics_cache_t *cache)
+{
+  uint16_t i;
+  for( i = 0; i < cache->cnt; i++ )
+  {
+    cache->tables[i].font = NULL;
+    cache->tables[i].last_use = 0;
+  }
+  cache->clock = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+}
+
+/* Use the cache for u8g2_GetGlyphWidth() and the string widths, NULL to stop */
+void u8g2_SetFontMetricsCache(u8g2_t *u8g2, u8g2_font_metrics_cache_t *cache)
+{
+  u8g2->font_metrics_cache = cache;
+  u8g2->font_metrics = NULL;
+}
+
+/* Find the table of u8g2->font in the cache, or clear the least recently used table for it */
+static u8g2_font_metrics_t *u8g2_select_font_metrics(u8g2_t *u8g2)
+{
+  u8g2_font_metrics_cache_t *cache = u8g2->font_metrics_cache;
+  u8g2_font_metrics_t *metrics;
+  u8g2_font_metrics_t *lru = NULL;
+  uint16_t i;
+
+  u8g2->font_metrics = NULL;
+  cache->clock++;
+  for( i = 0; i < cache->cnt; i++ )
+  {
+    metrics = cache->tables + i;
+    if ( metrics->font == u8g2->font )
+    {
+      metrics->last_use = cache->clock;
+      u8g2->font_metrics = metrics;
+      return metrics;
+    }
+    if ( lru == NULL || metrics->last_use < lru->last_use )
+      lru = metrics;
+  }
+
+  if ( lru == NULL )
+    return NULL;
+  memset(lru->glyphs, 0, sizeof(lru->glyphs));	/* U8G2_GLYPH_METRICS_UNKNOWN */
+  lru->font = u8g2->font;
+  lru->last_use = cache->clock;
+  u8g2->font_metrics = lru;
+  return lru;
+}
+
+/*
+  Metrics of the glyph of the current font, read from the font on the
+  first call for the glyph, as u8g2_GetGlyphWidth() reads them. Returns
+  NULL for encodings above 255 and for a cache without tables.
+*/
+const u8g2_glyph_metrics_t *u8g2_font_get_glyph_metrics(u8g2_t *u8g2, uint16_t encoding)
+{
+  u8g2_font_metrics_t *metrics = u8g2->font_metrics;
+  u8g2_glyph_metrics_t *glyph;
+  const uint8_t *glyph_data;
+  u8g2_glyph_header_t header;
+  u8g2_font_decode_t decode;
+
+  if ( encoding > 255 )
+    return NULL;
+  if ( metrics == NULL || metrics->font != u8g2->font )
+  {
+    metrics = u8g2_select_font_metrics(u8g2);
+    if ( metrics == NULL )
+      return NULL;
+  }
+
+  glyph = metrics->glyphs + encoding;
+  if ( glyph->state != U8G2_GLYPH_METRICS_UNKNOWN )
+  {
+    u8g2->font_metrics_cache->hits++;
+    return glyph;
+  }
+
+  u8g2->font_metrics_cache->misses++;
+  glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
+  if ( glyph_data == NULL )
+  {
+    glyph->state = U8G2_GLYPH_METRICS_NO_GLYPH;
+    return glyph;
+  }
+  u8g2_font_read_glyph_header(u8g2, &decode, glyph_data, &header);
+  glyph->w = header.w;
+  glyph->h = header.h;
+  glyph->x = header.x;
+  glyph->d = header.d;
+  glyph->state = U8G2_GLYPH_METRICS_GLYPH;
+  return glyph;
+}
+
+/*
+  cnt		number of entries
+  entries	cnt entries
+  data		cnt * slot_size chars
+  slot_size	longest string which is cached
+*/
+void u8g2_InitStrWidthCache(u8g2_str_width_cache_t *cache, u8g2_str_width_entry_t *entries, uint16_t cnt, char *data, uint16_t slot_size)
+{
+  cache->entries = entries;
+  cache->data = data;
+  cache->cnt = cnt;
+  cache->sets = cnt / U8G2_STR_WIDTH_CACHE_WAYS;
+  if ( cache->sets == 0 )
+    cache->sets = 1;
+  cache->slot_size = slot_size;
+  u8g2_ClearStrWidthCache(cache);
+}
+
+/* Remove all strings and reset the counters */
+void u8g2_ClearStrWidthCache(u8g2_str_width_cache_t *cache)
+{
+  uint16_t i;
+  for( i = 0; i < cache->cnt; i++ )
+  {
+    cache->entries[i].font = NULL;
+    cache->entries[i].last_use = 0;
+  }
+  cache->clock = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+}
+
+/* Use the cache for u8g2_GetStrWidth() and u8g2_GetUTF8Width(), NULL to stop */
+void u8g2_SetStrWidthCache(u8g2_t *u8g2, u8g2_str_width_cache_t *cache)
+{
+  u8g2->str_width_cache = cache;
+}
+
+/*
+  The width of a string depends on the glyph_x_offset of the previous
+  measurement if its first glyph is not in the font, and so do the
+  values left in glyph_x_offset if it has no glyph at all: such strings
+  are not cached.
+*/
+static uint8_t u8g2_str_width_is_cacheable(u8g2_t *u8g2, const char *str)
+{
+  uint16_t e;
+
+  u8x8_utf8_init(u8g2_GetU8x8(u8g2));
+  for(;;)
+  {
+    e = u8g2->u8x8.next_cb(u8g2_GetU8x8(u8g2), (uint8_t)*str);
+    if ( e == 0x0ffff )
+      return 0;
+    str++;
+    if ( e != 0x0fffe )
+      return u8g2_IsGlyph(u8g2, e);
+  }
+}
+
+/*
+  u8g2_GetStrWidth() and u8g2_GetUTF8Width() with the string width cache:
+  return the width from the cache, or measure the string and keep it in
+  the least recently used entry of its set.
+*/
+u8g2_uint_t u8g2_get_cached_str_width(u8g2_t *u8g2, const char *str)
+{
+  u8g2_str_width_cache_t *cache = u8g2->str_width_cache;
+  u8g2_str_width_entry_t *entry;
+  u8g2_str_width_entry_t *lru = NULL;
+  const uint8_t *font = u8g2->font;
+  u8x8_char_cb next_cb = u8g2->u8x8.next_cb;
+  uint32_t hash = 2166136261UL;		/* FNV-1a */
+  size_t len = 0;
+  u8g2_uint_t width;
+  uint16_t i, ways;
+
+  while( str[len] != '\0' )
+  {
+    hash ^= (uint8_t)str[len];
+    hash *= 16777619UL;
+    len++;
+  }
+
+  cache->clock++;
+  if ( cache->cnt > 0 && len <= cache->slot_size )
+  {
+    i = (uint16_t)((hash ^ ((uint32_t)(size_t)font >> 3)) % cache->sets);
+    ways = U8G2_STR_WIDTH_CACHE_WAYS;
+    if ( i == cache->sets - 1 )
+      ways = cache->cnt - i*U8G2_STR_WIDTH_CACHE_WAYS;	/* the last set has the remaining entries */
+    for( entry = cache->entries + i*U8G2_STR_WIDTH_CACHE_WAYS; ways > 0; ways--, entry++ )
+    {
+      if ( entry->font == font && entry->next_cb == next_cb && entry->hash == hash && entry->len == len
+	&& memcmp(cache->data + (uint32_t)(entry - cache->entries)*cache->slot_size, str, len) == 0 )
+      {
+	cache->hits++;
+	entry->last_use = cache->clock;
+	u8g2->font_decode.glyph_width = entry->glyph_width;
+	u8g2->glyph_x_offset = entry->glyph_x_offset;
+	return entry->width;
+      }
+      if ( lru == NULL || entry->last_use < lru->last_use )
+	lru = entry;
+    }
+  }
+
+  cache->misses++;
+  width = u8g2_font_calc_str_width(u8g2, str);
+  if ( lru != NULL && u8g2_str_width_is_cacheable(u8g2, str) )
+  {
+    memcpy(cache->data + (uint32_t)(lru - cache->entries)*cache->slot_size, str, len);
+    lru->font = font;
+    lru->next_cb = next_cb;
+    lru->hash = hash;
+    lru->len = (uint16_t)len;
+    lru->width = width;
+    lru->glyph_width = u8g2->font_decode.glyph_width;
+    lru->glyph_x_offset = u8g2->glyph_x_offset;
+    lru->last_use = cache->clock;
+  }
+  return width;
+}
+
+#endif /* U8G2_WITH_FONT_METRICS */
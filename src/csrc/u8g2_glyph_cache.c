@@ -0,0 +1,208 @@
+/*
+
+  u8g2_glyph_cache.c (libu8g2arm)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  Glyph cache: glyphs decoded once and drawn as sprites.
+
+  u8g2_font_decode_glyph() reads the run length code of a glyph bit by
+  bit and draws each run with u8g2_DrawHVLine(). With a glyph cache, a
+  glyph is decoded once into an XBM bitmap, rotated for the font
+  direction, which is converted into a sprite (see u8g2_sprite.c) for
+  the buffer layout and rotation. Later draws of the glyph draw the
+  sprite, with the font mode as bitmap transparency, which sets the same
+  pixels as decoding the glyph.
+
+  Glyphs are identified by the address of the font, the encoding and the
+  font direction. All memory is provided by the caller: cnt entries,
+  each with a slot of slot_size bytes, and glyphs which do not fit into
+  a slot are decoded as before.
+
+*/
+
+#include "u8g2.h"
+#include <string.h>
+
+#ifdef U8G2_WITH_GLYPH_CACHE
+
+/*
+  Bytes for a slot which can hold any glyph of the current font, with
+  the current rotation and buffer layout.
+*/
+uint32_t u8g2_GetGlyphCacheSlotSize(u8g2_t *u8g2)
+{
+  u8g2_uint_t w = (uint8_t)u8g2->font_info.max_char_width;
+  u8g2_uint_t h = (uint8_t)u8g2->font_info.max_char_height;
+  uint32_t a, b;
+
+  a = (uint32_t)((w+7)>>3)*h + u8g2_GetSpriteDataSize(u8g2, w, h);
+  b = (uint32_t)((h+7)>>3)*w + u8g2_GetSpriteDataSize(u8g2, h, w);
+  return a > b ? a : b;
+}
+
+/*
+  cnt		number of entries
+  entries	cnt entries
+  data		cnt * slot_size bytes
+  slot_size	bytes for the bitmap and the sprite of a glyph, see u8g2_GetGlyphCacheSlotSize()
+*/
+void u8g2_InitGlyphCache(u8g2_glyph_cache_t *cache, u8g2_glyph_cache_entry_t *entries, uint16_t cnt, uint8_t *data, uint32_t slot_size)
+{
+  cache->entries = entries;
+  cache->data = data;
+  cache->cnt = cnt;
+  cache->sets = cnt / U8G2_GLYPH_CACHE_WAYS;
+  if ( cache->sets == 0 )
+    cache->sets = 1;
+  cache->slot_size = slot_size;
+  u8g2_ClearGlyphCache(cache);
+}
+
+/* Remove all glyphs and reset the counters */
+void u8g2_ClearGlyphCache(u8g2_glyph_cache_t *cache)
+{
+  uint16_t i;
+  for( i = 0; i < cache->cnt; i++ )
+  {
+    cache->entries[i].font = NULL;
+    cache->entries[i].last_use = 0;
+  }
+  cache->clock = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+}
+
+/* Use the cache for u8g2_DrawGlyph() and the string procedures, NULL to stop */
+void u8g2_SetGlyphCache(u8g2_t *u8g2, u8g2_glyph_cache_t *cache)
+{
+  u8g2->glyph_cache = cache;
+}
+
+/*
+  Convert the bitmap of the entry into a sprite for the current rotation
+  and buffer layout, or leave the sprite without data, if the sprite does
+  not fit into the slot.
+*/
+static void u8g2_glyph_cache_init_sprite(u8g2_t *u8g2, u8g2_glyph_cache_t *cache, u8g2_glyph_cache_entry_t *entry, u8g2_uint_t bw, u8g2_uint_t bh)
+{
+  uint8_t *slot = cache->data + (uint32_t)(entry - cache->entries)*cache->slot_size;
+  uint32_t bitmap_size = (uint32_t)((bw+7)>>3)*bh;
+  uint32_t sprite_size = u8g2_GetSpriteDataSize(u8g2, bw, bh);
+
+  u8g2_InitSprite(u8g2, &(entry->sprite), bw, bh, slot,
+    bitmap_size + sprite_size <= cache->slot_size ? slot + bitmap_size : NULL);
+}
+
+/* Draw the glyph of the entry at x,y with the font mode as bitmap transparency */
+static void u8g2_glyph_cache_draw(u8g2_t *u8g2, u8g2_glyph_cache_entry_t *entry, u8g2_uint_t x, u8g2_uint_t y)
+{
+  uint8_t bitmap_transparency = u8g2->bitmap_transparency;
+
+  u8g2->bitmap_transparency = (u8g2->font_decode.is_transparent != 0);
+  u8g2_DrawSprite(u8g2, x + entry->off_x, y + entry->off_y, &(entry->sprite));
+  u8g2->bitmap_transparency = bitmap_transparency;
+}
+
+/*
+  u8g2_font_draw_glyph() with the glyph cache: draw the glyph from the
+  cache, or decode it into the least recently used entry of its set.
+  Returns the delta x of the glyph.
+*/
+u8g2_uint_t u8g2_draw_cached_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
+{
+  u8g2_glyph_cache_t *cache = u8g2->glyph_cache;
+  u8g2_glyph_cache_entry_t *entry;
+  u8g2_glyph_cache_entry_t *lru = NULL;
+  const uint8_t *font = u8g2->font;
+  const uint8_t *glyph_data;
+  u8g2_glyph_header_t header;
+  u8g2_font_decode_t decode;
+  u8g2_uint_t bw, bh, tx, ty;
+  uint32_t size;
+  uint16_t i, ways;
+  uint8_t dir = 0;
+
+#ifdef U8G2_WITH_FONT_ROTATION
+  dir = u8g2->font_decode.dir;
+#endif
+
+  cache->clock++;
+  if ( cache->cnt > 0 )
+  {
+    i = (uint16_t)((((uint32_t)(size_t)font >> 3) ^ ((uint32_t)encoding * 0x9e3779b1UL) ^ dir) % cache->sets);
+    ways = U8G2_GLYPH_CACHE_WAYS;
+    if ( i == cache->sets - 1 )
+      ways = cache->cnt - i*U8G2_GLYPH_CACHE_WAYS;	/* the last set has the remaining entries */
+    for( entry = cache->entries + i*U8G2_GLYPH_CACHE_WAYS; ways > 0; ways--, entry++ )
+    {
+      if ( entry->font == font && entry->encoding == encoding && entry->dir == dir )
+      {
+	cache->hits++;
+	entry->last_use = cache->clock;
+	if ( entry->sprite.cb != u8g2->cb || entry->sprite.ll_hvline != u8g2->ll_hvline )
+	  u8g2_glyph_cache_init_sprite(u8g2, cache, entry, entry->sprite.w, entry->sprite.h);
+	u8g2_glyph_cache_draw(u8g2, entry, x, y);
+	return entry->delta_x;
+      }
+      if ( lru == NULL || entry->last_use < lru->last_use )
+	lru = entry;
+    }
+  }
+
+  glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
+  if ( glyph_data == NULL )
+    return 0;
+  cache->misses++;
+
+  u8g2_font_read_glyph_header(u8g2, &decode, glyph_data, &header);
+  u8g2_font_get_glyph_box(&header, dir, x, y, &tx, &ty, &bw, &bh);
+  size = (uint32_t)((bw+7)>>3)*bh;
+  if ( header.w == 0 || lru == NULL || size > cache->slot_size )
+  {
+    u8g2->font_decode.target_x = x;
+    u8g2->font_decode.target_y = y;
+    return u8g2_font_decode_glyph(u8g2, glyph_data);
+  }
+
+  lru->font = NULL;
+  memset(cache->data + (uint32_t)(lru - cache->entries)*cache->slot_size, 0, size);
+  u8g2_font_decode_glyph_xbm(u8g2, &decode, &header, cache->data + (uint32_t)(lru - cache->entries)*cache->slot_size, (bw+7)>>3, 0, 0, dir);
+  u8g2_glyph_cache_init_sprite(u8g2, cache, lru, bw, bh);
+
+  lru->font = font;
+  lru->encoding = encoding;
+  lru->dir = dir;
+  lru->delta_x = header.d;
+  lru->off_x = tx - x;
+  lru->off_y = ty - y;
+  lru->last_use = cache->clock;
+  u8g2_glyph_cache_draw(u8g2, lru, x, y);
+  return header.d;
+}
+
+#endif /* U8G2_WITH_GLYPH_CACHE */
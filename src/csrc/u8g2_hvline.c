@@ -39,6 +39,15 @@
     u8g2_draw_hv_line_2dir
     u8g2->ll_hvline(u8g2, x, y, len, dir);
     
+    void u8g2_DrawHVBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+    u8g2->cb->draw_box_l90
+    u8g2_draw_ll_box
+    u8g2->ll_box(u8g2, x, y, w, h);
+
+    void u8g2_DrawHVBlit(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+    u8g2->cb->draw_blit_l90
+    u8g2_draw_ll_blit
+    u8g2->ll_blit(u8g2, x, y, w, h, blit);
 
 */
 
@@ -137,10 +146,59 @@ void u8g2_draw_hv_line_2dir(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uin
   /* transform to pixel buffer coordinates */
   y -= u8g2->pixel_curr_row;
   
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_ptr != NULL )
+  {
+    if ( dir == 0 )
+      u8g2_mark_dirty_tiles(u8g2, x>>3, y>>3, (x+len-1)>>3, y>>3);
+    else
+      u8g2_mark_dirty_tiles(u8g2, x>>3, y>>3, x>>3, (y+len-1)>>3);
+  }
+#endif /* U8G2_WITH_DIRTY_TILES */
+
   u8g2->ll_hvline(u8g2, x, y, len, dir);
 }
 
 
+/*
+  x,y		Upper left position of the box within the pixel buffer 
+  w,h		width and height of the box in pixel, w and h must not be 0
+  This is the box equivalent of u8g2_draw_hv_line_2dir(): the y position
+  is adjusted to the local buffer and the box is passed to u8g2->ll_box.
+*/
+void u8g2_draw_ll_box(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  /* transform to pixel buffer coordinates */
+  y -= u8g2->pixel_curr_row;
+  
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_ptr != NULL )
+    u8g2_mark_dirty_tiles(u8g2, x>>3, y>>3, (x+w-1)>>3, (y+h-1)>>3);
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+  u8g2->ll_box(u8g2, x, y, w, h);
+}
+
+/*
+  x,y		Upper left position of the box within the pixel buffer 
+  w,h		width and height of the box in pixel, w and h must not be 0
+  blit		the bitmap, with the steps in pixel buffer directions
+  The bitmap equivalent of u8g2_draw_ll_box().
+*/
+void u8g2_draw_ll_blit(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  /* transform to pixel buffer coordinates */
+  y -= u8g2->pixel_curr_row;
+  
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_ptr != NULL )
+    u8g2_mark_dirty_tiles(u8g2, x>>3, y>>3, (x+w-1)>>3, (y+h-1)>>3);
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+  u8g2->ll_blit(u8g2, x, y, w, h, blit);
+}
+
+
 /*
   This is the toplevel function for the hv line draw procedures.
   This function should be called by the user.
@@ -200,6 +258,99 @@ void u8g2_DrawHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len
     }
 }
 
+/*
+  Draw a filled box with one clip against the user window and one call of
+  the rotation callback, instead of one u8g2_DrawHVLine() per line.
+  Rotation callbacks without a box procedure get the box line by line.
+*/
+void u8g2_DrawHVBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection != 0 )
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+    if ( w != 0 && h != 0 )
+    {
+      /* clip against the user window */
+      if ( u8g2_clip_intersection2(&x, &w, u8g2->user_x0, u8g2->user_x1) == 0 )
+	return;
+      if ( u8g2_clip_intersection2(&y, &h, u8g2->user_y0, u8g2->user_y1) == 0 )
+	return;
+      
+      if ( u8g2->cb->draw_box_l90 != NULL )
+      {
+	u8g2->cb->draw_box_l90(u8g2, x, y, w, h);
+      }
+      else
+      {
+	do
+	{
+	  u8g2->cb->draw_l90(u8g2, x, y, w, 0);
+	  y++;
+	  h--;
+	} while( h != 0 );
+      }
+    }
+}
+
+/*
+  Draw a bitmap into a box with one clip against the user window and one
+  call of the rotation callback. blit->sx,sy is the bitmap pixel drawn at
+  x,y, and the bitmap steps must be 1 in the user x and y directions
+  (dx_x = 1, dy_x = 0, dx_y = 0, dy_y = 1).
+  Rotation callbacks without a bitmap procedure get the bitmap pixel by
+  pixel.
+*/
+void u8g2_DrawHVBlit(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  u8g2_blit_t clipped;
+  u8g2_uint_t xx, yy;
+  
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection != 0 )
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+    if ( w != 0 && h != 0 )
+    {
+      /* clip against the user window, and move the bitmap origin with the box */
+      xx = x;
+      yy = y;
+      if ( u8g2_clip_intersection2(&xx, &w, u8g2->user_x0, u8g2->user_x1) == 0 )
+	return;
+      if ( u8g2_clip_intersection2(&yy, &h, u8g2->user_y0, u8g2->user_y1) == 0 )
+	return;
+      clipped = *blit;
+      clipped.sx += (u8g2_uint_t)(xx - x);
+      clipped.sy += (u8g2_uint_t)(yy - y);
+      
+      if ( u8g2->cb->draw_blit_l90 != NULL )
+      {
+	u8g2->cb->draw_blit_l90(u8g2, xx, yy, w, h, &clipped);
+      }
+      else
+      {
+	uint8_t color = u8g2->draw_color;
+	uint8_t ncolor = (color == 0 ? 1 : 0);
+	u8g2_uint_t i, j;
+	for( j = 0; j < h; j++ )
+	{
+	  for( i = 0; i < w; i++ )
+	  {
+	    if ( u8g2_blit_pixel(&clipped, clipped.sx+i, clipped.sy+j) )
+	    {
+	      u8g2->draw_color = color;
+	      u8g2->cb->draw_l90(u8g2, xx+i, yy+j, 1, 0);
+	    }
+	    else if ( u8g2->bitmap_transparency == 0 )
+	    {
+	      u8g2->draw_color = ncolor;
+	      u8g2->cb->draw_l90(u8g2, xx+i, yy+j, 1, 0);
+	    }
+	  }
+	}
+	u8g2->draw_color = color;
+      }
+    }
+}
+
 void u8g2_DrawHLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len)
 {
 // #ifdef U8G2_WITH_INTERSECTION
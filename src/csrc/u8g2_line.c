@@ -36,57 +36,303 @@
 #include "u8g2.h"
 
 
+/*
+  Coordinates of a line: in 16 bit mode, values above 0x7fff are negative
+  (left or above the display), so that lines can start outside of the
+  display.
+*/
+#ifdef U8G2_16BIT
+#define u8g2_line_coord(v) ((u8g2_long_t)(int16_t)(v))
+#else
+#define u8g2_line_coord(v) ((u8g2_long_t)(v))
+#endif
+
+/*
+  Bresenham line, drawn as runs: all pixels of a line with the same minor
+  coordinate are one horizontal or vertical line. The pixels are the same
+  as for the pixel by pixel algorithm, which starts at the end with the
+  lower major coordinate and steps the minor coordinate, whenever the error
+  term (starting with dx/2) gets negative.
+
+  With i the major step and k the minor step, pixel i is in run
+    k(i) = (i*dy + dx - 1 - dx/2) / dx
+  and run k ends with the pixel
+    i = (k*dx + dx/2) / dy
+
+  The line is clipped against the user window once: the range of i
+  is limited by the window in the major direction and, through the
+  inverse of k(i), by the window in the minor direction. All products are
+  below 2^32, so that uint32_t is sufficient for lines up to 0xffff pixels.
+*/
 void u8g2_DrawLine(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2)
 {
-  u8g2_uint_t tmp;
-  u8g2_uint_t x,y;
-  u8g2_uint_t dx, dy;
-  u8g2_int_t err;
-  u8g2_int_t ystep;
-
+  u8g2_long_t ax, ay, bx, by;	/* end points, major coordinate first */
+  u8g2_long_t wx0, wx1, wy0, wy1;	/* user window, major coordinate first */
+  u8g2_long_t dx, dy, tmp;
+  u8g2_long_t kmin, kmax;
+  uint32_t ilo, ihi, iend, t;
+  uint32_t base, rem, e, h;
+  u8g2_uint_t x, y, len;
+  int8_t ystep;
   uint8_t swapxy = 0;
-  
-  /* no intersection check at the moment, should be added... */
 
-  if ( x1 > x2 ) dx = x1-x2; else dx = x2-x1;
-  if ( y1 > y2 ) dy = y1-y2; else dy = y2-y1;
+  ax = u8g2_line_coord(x1);
+  ay = u8g2_line_coord(y1);
+  bx = u8g2_line_coord(x2);
+  by = u8g2_line_coord(y2);
+  wx0 = u8g2->user_x0;
+  wx1 = u8g2->user_x1;
+  wy0 = u8g2->user_y0;
+  wy1 = u8g2->user_y1;
+
+  dx = bx - ax;
+  if ( dx < 0 ) dx = -dx;
+  dy = by - ay;
+  if ( dy < 0 ) dy = -dy;
 
   if ( dy > dx ) 
   {
     swapxy = 1;
-    tmp = dx; dx =dy; dy = tmp;
-    tmp = x1; x1 =y1; y1 = tmp;
-    tmp = x2; x2 =y2; y2 = tmp;
+    tmp = dx; dx = dy; dy = tmp;
+    tmp = ax; ax = ay; ay = tmp;
+    tmp = bx; bx = by; by = tmp;
+    tmp = wx0; wx0 = wy0; wy0 = tmp;
+    tmp = wx1; wx1 = wy1; wy1 = tmp;
   }
-  if ( x1 > x2 ) 
+  if ( ax > bx ) 
   {
-    tmp = x1; x1 =x2; x2 = tmp;
-    tmp = y1; y1 =y2; y2 = tmp;
+    tmp = ax; ax = bx; bx = tmp;
+    tmp = ay; ay = by; by = tmp;
   }
-  err = dx >> 1;
-  if ( y2 > y1 ) ystep = 1; else ystep = -1;
-  y = y1;
+  if ( by > ay ) ystep = 1; else ystep = -1;
 
-#ifndef  U8G2_16BIT
-  if ( x2 == 255 )
-    x2--;
-#else
-  if ( x2 == 0xffff )
-    x2--;
-#endif
+  /* clip the major direction */
+  if ( bx < wx0 || ax >= wx1 )
+    return;
+  ilo = 0;
+  if ( ax < wx0 )
+    ilo = wx0 - ax;
+  ihi = dx;
+  if ( bx >= wx1 )
+    ihi = wx1 - 1 - ax;
+
+  /* clip the minor direction: range of k, then the i for this range */
+  if ( ystep > 0 )
+  {
+    kmin = wy0 - ay;
+    kmax = wy1 - 1 - ay;
+  }
+  else
+  {
+    kmin = ay - (wy1 - 1);
+    kmax = ay - wy0;
+  }
+  if ( kmin < 0 )
+    kmin = 0;
+  if ( kmax > dy )
+    kmax = dy;
+  if ( kmin > kmax )
+    return;
+  h = dx >> 1;
+  if ( kmin > 0 )
+  {
+    /* first i with k(i) >= kmin */
+    t = ((uint32_t)(kmin-1)*dx + h + dy) / dy;
+    if ( ilo < t )
+      ilo = t;
+  }
+  if ( kmax < dy )
+  {
+    /* last i with k(i) <= kmax */
+    t = ((uint32_t)kmax*dx + h) / dy;
+    if ( ihi > t )
+      ihi = t;
+  }
+  if ( ilo > ihi )
+    return;
+
+  /* the run of the first visible pixel */
+  if ( dx == 0 )
+  {
+    t = 0;
+    iend = 0;
+    base = 0;
+    rem = 0;
+    e = 0;
+  }
+  else
+  {
+    t = ((uint32_t)ilo*dy + dx - 1 - h) / dx;
+    if ( dy == 0 )
+    {
+      iend = ihi;
+      base = 0;
+      rem = 0;
+      e = 0;
+    }
+    else
+    {
+      e = (uint32_t)t*dx + h;
+      iend = e / dy;
+      e = e % dy;
+      base = dx / dy;
+      rem = dx % dy;
+    }
+  }
 
-  for( x = x1; x <= x2; x++ )
+  x = (u8g2_uint_t)(ax + ilo);
+  y = (u8g2_uint_t)(ay + (ystep > 0 ? (u8g2_long_t)t : -(u8g2_long_t)t));
+  for(;;)
   {
+    if ( iend > ihi )
+      iend = ihi;
+    len = (u8g2_uint_t)(iend - ilo + 1);
     if ( swapxy == 0 ) 
-      u8g2_DrawPixel(u8g2, x, y); 
+      u8g2_DrawHVLine(u8g2, x, y, len, 0);
     else 
-      u8g2_DrawPixel(u8g2, y, x); 
-    err -= (uint8_t)dy;
-    if ( err < 0 ) 
+      u8g2_DrawHVLine(u8g2, y, x, len, 1);
+    if ( iend >= ihi )
+      break;
+    x += len;
+    ilo = iend + 1;
+    y += (u8g2_uint_t)ystep;
+    iend += base;
+    e += rem;
+    if ( e >= (uint32_t)dy )
     {
-      y += (u8g2_uint_t)ystep;
-      err += (u8g2_uint_t)dx;
+      e -= dy;
+      iend++;
     }
   }
 }
 
+
+/*
+  Limit the span lo..hi to the values t with alpha*t + beta >= 0. The
+  span is empty if lo > hi afterwards.
+*/
+void u8g2_limit_span(u8g2_long_t alpha, u8g2_long_t beta, u8g2_long_t *lo, u8g2_long_t *hi)
+{
+  u8g2_long_t t;
+
+  if ( alpha == 0 )
+  {
+    if ( beta < 0 )
+      *lo = *hi + 1;
+    return;
+  }
+  if ( alpha > 0 )
+  {
+    /* t >= -beta/alpha, rounded up */
+    t = -beta;
+    if ( t >= 0 )
+      t = (t + alpha - 1) / alpha;
+    else
+      t = -(-t / alpha);
+    if ( *lo < t )
+      *lo = t;
+  }
+  else
+  {
+    /* t <= beta/-alpha, rounded down */
+    alpha = -alpha;
+    if ( beta >= 0 )
+      t = beta / alpha;
+    else
+      t = -((-beta + alpha - 1) / alpha);
+    if ( *hi > t )
+      *hi = t;
+  }
+}
+
+/* integer square root, rounded down */
+static uint32_t u8g2_isqrt(uint32_t v)
+{
+  uint32_t r = 0;
+  uint32_t bit = (uint32_t)1 << 30;
+
+  while ( bit > v )
+    bit >>= 2;
+  while ( bit != 0 )
+  {
+    if ( v >= r + bit )
+    {
+      v -= r + bit;
+      r = (r >> 1) + bit;
+    }
+    else
+    {
+      r >>= 1;
+    }
+    bit >>= 2;
+  }
+  return r;
+}
+
+/*
+  A line with the width w: the pixels with a distance of at most w/2 from
+  the line between x0,y0 and x1,y1, drawn as one horizontal span for each
+  row. The ends are cut square at x0,y0 and x1,y1. A line with w <= 1 is
+  drawn with u8g2_DrawLine(). The line must be shorter than 2048 pixels.
+*/
+void u8g2_DrawThickLine(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t w)
+{
+  u8g2_long_t dx, dy;
+  u8g2_long_t len2;	/* square of the length */
+  u8g2_long_t lw;	/* 16 * length * w */
+  u8g2_long_t e;	/* extent of the line ends */
+  u8g2_long_t qy, qy1;
+  u8g2_long_t lo, hi;
+  u8g2_uint_t y;
+
+  if ( w <= 1 )
+  {
+    u8g2_DrawLine(u8g2, x0, y0, x1, y1);
+    return;
+  }
+
+  dx = (int16_t)(x1 - x0);
+  dy = (int16_t)(y1 - y0);
+  if ( dx == 0 && dy == 0 )
+  {
+    u8g2_DrawBox(u8g2, x0 - w/2, y0 - w/2, w, w);
+    return;
+  }
+  e = w/2 + 1;
+
+  /* check for bounding box */
+#ifdef U8G2_WITH_INTERSECTION
+  {
+    if ( u8g2_IsIntersection(u8g2, 
+	x0 + (u8g2_uint_t)((dx < 0 ? dx : 0) - e), y0 + (u8g2_uint_t)((dy < 0 ? dy : 0) - e), 
+	x0 + (u8g2_uint_t)((dx > 0 ? dx : 0) + e + 1), y0 + (u8g2_uint_t)((dy > 0 ? dy : 0) + e + 1)) == 0 ) 
+      return;
+  }
+#endif /* U8G2_WITH_INTERSECTION */
+
+  len2 = dx*dx + dy*dy;
+  lw = u8g2_isqrt((uint32_t)len2 << 8);
+  lw *= w;
+
+  /* 
+    q = (qx, qy) is the pixel relative to x0,y0, it is on the line if
+      0 <= q.d <= |d|^2			(between both ends)
+      -w|d|/2 < d x q <= w|d|/2		(distance to the line)
+    with d = (dx, dy). For each row, this limits qx to a span.
+  */
+  qy1 = (dy > 0 ? dy : 0) + e;
+  for( qy = (dy < 0 ? dy : 0) - e; qy <= qy1; qy++ )
+  {
+    y = y0 + (u8g2_uint_t)qy;
+    if ( y < u8g2->user_y0 || y >= u8g2->user_y1 )
+      continue;
+    lo = (dx < 0 ? dx : 0) - e;
+    hi = (dx > 0 ? dx : 0) + e;
+    u8g2_limit_span(dx, dy*qy, &lo, &hi);
+    u8g2_limit_span(-dx, len2 - dy*qy, &lo, &hi);
+    u8g2_limit_span(32*dy, lw - 32*dx*qy, &lo, &hi);
+    u8g2_limit_span(-32*dy, lw + 32*dx*qy - 1, &lo, &hi);
+    if ( lo <= hi )
+      u8g2_DrawHVLine(u8g2, x0 + (u8g2_uint_t)lo, y, hi - lo + 1, 0);
+  }
+}
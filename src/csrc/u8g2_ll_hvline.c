@@ -50,6 +50,92 @@
 
 #include "u8g2.h"
 #include <assert.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/*=================================================*/
+/*
+  Apply or_mask and xor_mask to len (>0) bytes starting at ptr. This is
+  the horizontal line of the vertical_top_lsb buffer, and the full bytes
+  of a box: 16 bytes are done per step with SSE2 or NEON, then 8 bytes
+  per step with 64 bit words, and any remaining bytes one at a time.
+*/
+static void u8g2_ll_mask_bytes(uint8_t *ptr, u8g2_uint_t len, uint8_t or_mask, uint8_t xor_mask)
+{
+  uint64_t or_word, xor_word, w;
+  
+#if defined(__SSE2__)
+  if ( len >= 16 )
+  {
+    __m128i or_vec = _mm_set1_epi8((char)or_mask);
+    __m128i xor_vec = _mm_set1_epi8((char)xor_mask);
+    __m128i v;
+    do
+    {
+      v = _mm_loadu_si128((__m128i *)ptr);
+      v = _mm_xor_si128(_mm_or_si128(v, or_vec), xor_vec);
+      _mm_storeu_si128((__m128i *)ptr, v);
+      ptr += 16;
+      len -= 16;
+    } while( len >= 16 );
+  }
+#elif defined(__ARM_NEON)
+  if ( len >= 16 )
+  {
+    uint8x16_t or_vec = vdupq_n_u8(or_mask);
+    uint8x16_t xor_vec = vdupq_n_u8(xor_mask);
+    uint8x16_t v;
+    do
+    {
+      v = vld1q_u8(ptr);
+      v = veorq_u8(vorrq_u8(v, or_vec), xor_vec);
+      vst1q_u8(ptr, v);
+      ptr += 16;
+      len -= 16;
+    } while( len >= 16 );
+  }
+#endif
+
+  if ( len >= 8 )
+  {
+    or_word = or_mask * 0x0101010101010101ULL;
+    xor_word = xor_mask * 0x0101010101010101ULL;
+    do
+    {
+      memcpy(&w, ptr, 8);
+      w |= or_word;
+      w ^= xor_word;
+      memcpy(ptr, &w, 8);
+      ptr += 8;
+      len -= 8;
+    } while( len >= 8 );
+  }
+  
+  while( len != 0 )
+  {
+    *ptr |= or_mask;
+    *ptr ^= xor_mask;
+    ptr++;
+    len--;
+  }
+}
+
+/*
+  Fill len (>0) bytes starting at ptr with the draw color
+*/
+static void u8g2_ll_fill_bytes(uint8_t *ptr, u8g2_uint_t len, uint8_t draw_color)
+{
+  if ( draw_color == 0 )
+    memset(ptr, 0, len);
+  else if ( draw_color == 1 )
+    memset(ptr, 0xff, len);
+  else
+    u8g2_ll_mask_bytes(ptr, len, 0, 0xff);
+}
 
 /*=================================================*/
 /*
@@ -107,47 +193,55 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
   
   if ( dir == 0 )
   {
-      do
-      {
 #ifdef __unix
-	assert(ptr < max_ptr);
+    assert(ptr + len <= max_ptr);
 #endif
-	*ptr |= or_mask;
-	*ptr ^= xor_mask;
-	ptr++;
-	len--;
-      } while( len != 0 );
+    u8g2_ll_mask_bytes(ptr, len, or_mask, xor_mask);
   }
   else
-  {    
-    do
-    {
+  {
+    /* the line is written a byte (8 lines) at a time, with the first and */
+    /* last byte masked and the full bytes in between written directly */
+    uint8_t bits;
+    uint16_t pixel_buf_width = u8g2->pixel_buf_width;	/* 6 Jan 17: Changed u8g2->width to u8g2->pixel_buf_width, issue #148 */
 #ifdef __unix
-      assert(ptr < max_ptr);
+    assert(ptr + ((bit_pos + len - 1) >> 3) * pixel_buf_width < max_ptr);
 #endif
+    
+    or_mask = 0;
+    xor_mask = 0;
+    if ( u8g2->draw_color <= 1 )
+      or_mask  = 0xff;
+    if ( u8g2->draw_color != 1 )
+      xor_mask = 0xff;
+    
+    if ( bit_pos != 0 )
+    {
+      bits = 8 - bit_pos;
+      if ( bits > len )
+	bits = len;
+      mask = (1 << bits) - 1;
+      mask <<= bit_pos;
+      *ptr |= or_mask & mask;
+      *ptr ^= xor_mask & mask;
+      ptr += pixel_buf_width;
+      len -= bits;
+    }
+    
+    while( len >= 8 )
+    {
       *ptr |= or_mask;
       *ptr ^= xor_mask;
-      
-      bit_pos++;
-      bit_pos &= 7;
-
-      len--;
-
-      if ( bit_pos == 0 )
-      {
-	ptr+=u8g2->pixel_buf_width;	/* 6 Jan 17: Changed u8g2->width to u8g2->pixel_buf_width, issue #148 */
-		
-	if ( u8g2->draw_color <= 1 )
-	  or_mask  = 1;
-	if ( u8g2->draw_color != 1 )
-	  xor_mask = 1;
-      }
-      else
-      {
-	or_mask <<= 1;
-	xor_mask <<= 1;
-      }
-    } while( len != 0 );
+      ptr += pixel_buf_width;
+      len -= 8;
+    }
+    
+    if ( len != 0 )
+    {
+      mask = (1 << len) - 1;
+      *ptr |= or_mask & mask;
+      *ptr ^= xor_mask & mask;
+    }
   }
 }
 
@@ -223,6 +317,63 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 
 #endif /* U8G2_WITH_HVLINE_SPEED_OPTIMIZATION */
 
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box in pixel, w and h must not be 0
+  asumption: 
+    all clipping done
+  Each page of 8 lines is one masked span of w bytes, and the pages
+  covered by the box from top to bottom are filled with memset.
+*/
+void u8g2_ll_box_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  uint16_t offset;
+  uint8_t *ptr;
+  uint8_t bit_pos, bits;
+  uint8_t mask, or_mask, xor_mask;
+#ifdef __unix
+  uint8_t *max_ptr = u8g2->tile_buf_ptr + u8g2_GetU8x8(u8g2)->display_info->tile_width*u8g2->tile_buf_height*8;
+#endif
+
+  offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+  offset &= ~7;
+  offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += offset;
+  ptr += x;
+
+  bit_pos = y;
+  bit_pos &= 7;
+  do
+  {
+#ifdef __unix
+    assert(ptr + w <= max_ptr);
+#endif
+    bits = 8 - bit_pos;
+    if ( bits > h )
+      bits = h;
+    if ( bits == 8 )
+    {
+      u8g2_ll_fill_bytes(ptr, w, u8g2->draw_color);
+    }
+    else
+    {
+      mask = (1 << bits) - 1;
+      mask <<= bit_pos;
+      or_mask = 0;
+      xor_mask = 0;
+      if ( u8g2->draw_color <= 1 )
+	or_mask  = mask;
+      if ( u8g2->draw_color != 1 )
+	xor_mask = mask;
+      u8g2_ll_mask_bytes(ptr, w, or_mask, xor_mask);
+    }
+    ptr += u8g2->pixel_buf_width;
+    h -= bits;
+    bit_pos = 0;
+  } while( h != 0 );
+}
+
 /*=================================================*/
 /*
   u8g2_ll_hvline_horizontal_right_lsb
@@ -284,12 +435,20 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
   }
   else
   {
+    /* the same bit of each line, with the draw color checked once */
+    uint8_t or_mask, xor_mask;
+    
+    or_mask = 0;
+    xor_mask = 0;
+    if ( u8g2->draw_color <= 1 )
+      or_mask  = mask;
+    if ( u8g2->draw_color != 1 )
+      xor_mask = mask;
+    
     do
     {
-      if ( u8g2->draw_color <= 1 )
-	*ptr |= mask;
-      if ( u8g2->draw_color != 1 )
-	*ptr ^= mask;
+      *ptr |= or_mask;
+      *ptr ^= xor_mask;
       
       ptr += tile_width;
       //y++;
@@ -369,3 +528,372 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
 }
 
 #endif /* U8G2_WITH_HVLINE_SPEED_OPTIMIZATION */
+
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box in pixel, w and h must not be 0
+  asumption: 
+    all clipping done
+  Each line of the box is a masked first and last byte, with the
+  bytes in between filled with memset.
+*/
+void u8g2_ll_box_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  uint16_t offset;
+  uint16_t x1;
+  uint8_t *ptr;
+  uint8_t first_mask, last_mask;
+  u8g2_uint_t cnt;
+  uint8_t tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+#ifdef __unix
+  uint8_t *max_ptr = u8g2->tile_buf_ptr + tile_width*u8g2->tile_buf_height*8;
+#endif
+
+  x1 = x;
+  x1 += w;
+  x1--;			/* last pixel of the line */
+  first_mask = 0xff >> (x & 7);
+  last_mask = 0xff << (7 - (x1 & 7));
+  cnt = (x1 >> 3) - (x >> 3);	/* number of bytes after the first byte */
+  if ( cnt == 0 )
+    first_mask &= last_mask;
+
+  offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+  offset *= tile_width;
+  offset += x>>3;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += offset;
+
+#ifdef __unix
+  assert(ptr + (h-1)*tile_width + cnt < max_ptr);
+#endif
+
+  do
+  {
+    if ( u8g2->draw_color <= 1 )
+      ptr[0] |= first_mask;
+    if ( u8g2->draw_color != 1 )
+      ptr[0] ^= first_mask;
+    if ( cnt != 0 )
+    {
+      if ( cnt > 1 )
+	u8g2_ll_fill_bytes(ptr+1, cnt-1, u8g2->draw_color);
+      if ( u8g2->draw_color <= 1 )
+	ptr[cnt] |= last_mask;
+      if ( u8g2->draw_color != 1 )
+	ptr[cnt] ^= last_mask;
+    }
+    ptr += tile_width;
+    h--;
+  } while( h != 0 );
+}
+
+/*=================================================*/
+/*
+  u8g2_ll_box_hvline
+    any buffer layout, with u8g2->ll_hvline
+*/
+
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box in pixel, w and h must not be 0
+  asumption: 
+    all clipping done
+*/
+void u8g2_ll_box_hvline(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  do
+  {
+    u8g2->ll_hvline(u8g2, x, y, w, 0);
+    y++;
+    h--;
+  } while( h != 0 );
+}
+
+/*=================================================*/
+/*
+  bitmap blit
+    u8g2_ll_blit_vertical_top_lsb
+    u8g2_ll_blit_horizontal_right_lsb
+    u8g2_ll_blit_hvline
+*/
+
+static uint8_t u8g2_ll_reverse_bits(uint8_t b)
+{
+  b = (b >> 4) | (b << 4);
+  b = ((b & 0xcc) >> 2) | ((b & 0x33) << 2);
+  b = ((b & 0xaa) >> 1) | ((b & 0x55) << 1);
+  return b;
+}
+
+uint8_t u8g2_blit_pixel(const u8g2_blit_t *blit, u8g2_uint_t sx, u8g2_uint_t sy)
+{
+  uint8_t b;
+  b = blit->bitmap[(uint32_t)sy*blit->stride + (sx>>3)];
+  if ( blit->is_msb_first )
+    b <<= sx & 7;
+  else
+    b = u8g2_ll_reverse_bits(b) << (sx & 7);
+  return b >> 7;
+}
+
+/*
+  n (1..8) pixels of the bitmap, from sx,sy and stepping step_x,step_y,
+  with the first pixel in bit 0. A step along a line of the bitmap takes
+  the pixels from one or two bytes, other steps take one pixel at a time.
+*/
+static uint8_t u8g2_ll_blit_get_bits(const u8g2_blit_t *blit, u8g2_uint_t sx, u8g2_uint_t sy, int8_t step_x, int8_t step_y, uint8_t n)
+{
+  const uint8_t *line;
+  uint16_t v;
+  uint8_t b, i, shift;
+  
+  if ( step_y == 0 )
+  {
+    if ( step_x < 0 )
+      sx -= n-1;
+    line = blit->bitmap + (uint32_t)sy*blit->stride + (sx>>3);
+    shift = sx & 7;
+    v = line[0];
+    if ( shift + n > 8 )
+      v |= line[1] << 8;
+    if ( blit->is_msb_first )
+      v = u8g2_ll_reverse_bits(v) | (u8g2_ll_reverse_bits(v >> 8) << 8);
+    b = v >> shift;
+    if ( step_x < 0 )
+      return u8g2_ll_reverse_bits(b) >> (8-n);
+    return b & (0xff >> (8-n));
+  }
+  
+  b = 0;
+  for( i = 0; i < n; i++ )
+  {
+    b |= u8g2_blit_pixel(blit, sx, sy) << i;
+    sx += step_x;
+    sy += step_y;
+  }
+  return b;
+}
+
+/*
+  Draw the pixels of mask in byte d: the set bits of bits with the draw
+  color, the other bits with the inverse color unless the bitmap is
+  transparent.
+*/
+static uint8_t u8g2_ll_blit_byte(u8g2_t *u8g2, uint8_t d, uint8_t bits, uint8_t mask)
+{
+  uint8_t fg = bits & mask;
+  
+  if ( u8g2->draw_color == 0 )
+    d &= ~fg;
+  else if ( u8g2->draw_color == 1 )
+    d |= fg;
+  else
+    d ^= fg;
+  
+  if ( u8g2->bitmap_transparency == 0 )
+  {
+    if ( u8g2->draw_color == 0 )
+      d |= ~bits & mask;
+    else
+      d &= ~(~bits & mask);
+  }
+  return d;
+}
+
+/*
+  Transpose the 8x8 pixel block in rows: bit i of rows[j] becomes bit j
+  of cols[i].
+*/
+static void u8g2_ll_transpose8(const uint8_t *rows, uint8_t *cols)
+{
+  uint64_t x = 0, t;
+  uint8_t i;
+  
+  for( i = 0; i < 8; i++ )
+    x |= (uint64_t)rows[i] << (i*8);
+  t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+  x = x ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+  x = x ^ t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+  x = x ^ t ^ (t << 28);
+  for( i = 0; i < 8; i++ )
+    cols[i] = x >> (i*8);
+}
+
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box in pixel, w and h must not be 0
+  blit		the bitmap, with sx,sy and the steps in buffer directions
+  asumption: 
+    all clipping done
+  Each buffer byte is 8 pixels down. When down in the buffer is along a
+  line of the bitmap (rotations R1 and R3) the byte is read from the
+  bitmap line, otherwise 8 lines of 8 pixels are read and transposed.
+*/
+void u8g2_ll_blit_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  uint16_t offset;
+  uint8_t *ptr;
+  uint8_t bit_pos, bits, mask, n;
+  uint8_t rows[8], cols[8];
+  u8g2_uint_t sx, sy, csx, csy, i, k;
+  uint8_t j;
+#ifdef __unix
+  uint8_t *max_ptr = u8g2->tile_buf_ptr + u8g2_GetU8x8(u8g2)->display_info->tile_width*u8g2->tile_buf_height*8;
+#endif
+
+  offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+  offset &= ~7;
+  offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += offset;
+  ptr += x;
+
+  sx = blit->sx;
+  sy = blit->sy;
+  bit_pos = y;
+  bit_pos &= 7;
+  do
+  {
+#ifdef __unix
+    assert(ptr + w <= max_ptr);
+#endif
+    bits = 8 - bit_pos;
+    if ( bits > h )
+      bits = h;
+    mask = (0xff >> (8 - bits)) << bit_pos;
+    
+    if ( blit->dy_y == 0 )
+    {
+      csx = sx;
+      csy = sy;
+      for( i = 0; i < w; i++ )
+      {
+	ptr[i] = u8g2_ll_blit_byte(u8g2, ptr[i], u8g2_ll_blit_get_bits(blit, csx, csy, blit->dx_y, blit->dy_y, bits) << bit_pos, mask);
+	csx += blit->dx_x;
+	csy += blit->dy_x;
+      }
+    }
+    else
+    {
+      for( i = 0; i < w; i += 8 )
+      {
+	n = 8;
+	if ( n > w - i )
+	  n = w - i;
+	csx = sx + i*blit->dx_x;
+	csy = sy + i*blit->dy_x;
+	for( j = 0; j < 8; j++ )
+	{
+	  rows[j] = 0;
+	  if ( j < bits )
+	  {
+	    rows[j] = u8g2_ll_blit_get_bits(blit, csx, csy, blit->dx_x, blit->dy_x, n);
+	    csx += blit->dx_y;
+	    csy += blit->dy_y;
+	  }
+	}
+	u8g2_ll_transpose8(rows, cols);
+	for( k = 0; k < n; k++ )
+	  ptr[i+k] = u8g2_ll_blit_byte(u8g2, ptr[i+k], cols[k] << bit_pos, mask);
+      }
+    }
+    
+    sx += bits*blit->dx_y;
+    sy += bits*blit->dy_y;
+    ptr += u8g2->pixel_buf_width;
+    h -= bits;
+    bit_pos = 0;
+  } while( h != 0 );
+}
+
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box in pixel, w and h must not be 0
+  blit		the bitmap, with sx,sy and the steps in buffer directions
+  asumption: 
+    all clipping done
+  Each buffer byte is 8 pixels to the right, the left pixel in the msb.
+  The pixels of a byte are read with one or two bitmap bytes when right
+  in the buffer is along a line of the bitmap (rotations R0 and R2).
+*/
+void u8g2_ll_blit_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  uint16_t offset;
+  uint8_t *ptr;
+  uint8_t bit_pos, n;
+  u8g2_uint_t sx, sy, i;
+  uint8_t tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+#ifdef __unix
+  uint8_t *max_ptr = u8g2->tile_buf_ptr + tile_width*u8g2->tile_buf_height*8;
+#endif
+
+  sx = blit->sx;
+  sy = blit->sy;
+  do
+  {
+    offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+    offset *= tile_width;
+    offset += x>>3;
+    ptr = u8g2->tile_buf_ptr;
+    ptr += offset;
+#ifdef __unix
+    assert(ptr + ((x + w - 1) >> 3) - (x >> 3) < max_ptr);
+#endif
+    
+    bit_pos = x;
+    bit_pos &= 7;
+    i = 0;
+    do
+    {
+      n = 8 - bit_pos;
+      if ( n > w - i )
+	n = w - i;
+      *ptr = u8g2_ll_blit_byte(u8g2, *ptr,
+	u8g2_ll_reverse_bits(u8g2_ll_blit_get_bits(blit, sx + i*blit->dx_x, sy + i*blit->dy_x, blit->dx_x, blit->dy_x, n)) >> bit_pos,
+	(uint8_t)(0xff << (8 - n)) >> bit_pos);
+      ptr++;
+      i += n;
+      bit_pos = 0;
+    } while( i < w );
+    
+    sx += blit->dx_y;
+    sy += blit->dy_y;
+    y++;
+    h--;
+  } while( h != 0 );
+}
+
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box in pixel, w and h must not be 0
+  blit		the bitmap, with sx,sy and the steps in buffer directions
+  asumption: 
+    all clipping done
+*/
+void u8g2_ll_blit_hvline(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  uint8_t color = u8g2->draw_color;
+  uint8_t ncolor = (color == 0 ? 1 : 0);
+  u8g2_uint_t i, j;
+  
+  for( j = 0; j < h; j++ )
+  {
+    for( i = 0; i < w; i++ )
+    {
+      if ( u8g2_blit_pixel(blit, blit->sx + i*blit->dx_x + j*blit->dx_y, blit->sy + i*blit->dy_x + j*blit->dy_y) )
+      {
+	u8g2->draw_color = color;
+	u8g2->ll_hvline(u8g2, x+i, y+j, 1, 0);
+      }
+      else if ( u8g2->bitmap_transparency == 0 )
+      {
+	u8g2->draw_color = ncolor;
+	u8g2->ll_hvline(u8g2, x+i, y+j, 1, 0);
+      }
+    }
+  }
+  u8g2->draw_color = color;
+}
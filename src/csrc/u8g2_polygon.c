@@ -318,6 +318,319 @@ static void pg_DrawPolygon(pg_struct *pg, u8g2_t *u8g2)
   pg_exec(pg, u8g2);
 }
 
+#ifdef U8G2_WITH_POLYGON_FILL
+
+/*===========================================*/
+/* reentrant polygon: active edge table scan line fill */
+
+/*
+  Each vertex also holds the scan state of the edge to the next vertex.
+
+  A pixel is inside the polygon, if its center (x+0.5, y+0.5) is inside,
+  so for a rectangle this gives the same pixels as u8g2_DrawBox(). The
+  first pixel right of an edge in row y is
+    ceil(xc - 0.5), with xc = xa + (y + 0.5 - ya) * dx / dy
+  which is ceil(n / (2*dy)) with n = 2*dy*xa - dy + (2*(y-ya)+1) * dx.
+  It is calculated once, when the edge gets visible, and then stepped
+  with n += 2*dx for each row.
+*/
+
+#define PG_NONE 0xffff
+
+void u8g2_InitPolygon(u8g2_polygon_t *pg, u8g2_polygon_vertex_t *vertices, uint16_t size)
+{
+  pg->vertices = vertices;
+  pg->size = size;
+  pg->cnt = 0;
+  pg->fill_rule = U8G2_POLYGON_EVEN_ODD;
+}
+
+void u8g2_ClearPolygon(u8g2_polygon_t *pg)
+{
+  pg->cnt = 0;
+}
+
+void u8g2_SetPolygonFillRule(u8g2_polygon_t *pg, uint8_t fill_rule)
+{
+  pg->fill_rule = fill_rule;
+}
+
+/* returns 0 if the polygon is full */
+uint8_t u8g2_AddPolygonVertex(u8g2_polygon_t *pg, int16_t x, int16_t y)
+{
+  if ( pg->cnt >= pg->size )
+    return 0;
+  pg->vertices[pg->cnt].x = x;
+  pg->vertices[pg->cnt].y = y;
+  pg->cnt++;
+  return 1;
+}
+
+/* u8g2_AddPolygonXY() and u8g2_DrawPolygon() use pg, NULL to use the global polygon again */
+void u8g2_SetPolygon(u8g2_t *u8g2, u8g2_polygon_t *pg)
+{
+  u8g2->polygon = pg;
+}
+
+/* state of the edge from xa,ya to xb,yb (ya < yb) at row y */
+static void pg_start_edge(u8g2_polygon_vertex_t *e, int32_t xa, int32_t ya, int32_t xb, int32_t yb, int32_t y)
+{
+  int32_t dx = xb - xa;
+  int32_t dy = yb - ya;
+  int64_t n;
+  int64_t x;
+
+  e->den = 2*dy;
+  n = (int64_t)e->den*xa - dy + (int64_t)(2*(y-ya)+1)*dx;
+  x = n / e->den;
+  if ( x*e->den < n )
+    x++;		/* round up */
+  e->cur_x = (int32_t)x;
+  e->err = (int32_t)(x*e->den - n);
+  
+  e->step = (2*dx) / e->den;
+  e->rem = (2*dx) % e->den;
+  if ( e->rem < 0 )
+  {
+    e->rem += e->den;
+    e->step--;
+  }
+  e->y0 = y;
+  e->y1 = yb;
+}
+
+static void pg_next_row(u8g2_polygon_vertex_t *e)
+{
+  e->cur_x += e->step;
+  e->err -= e->rem;
+  if ( e->err < 0 )
+  {
+    e->cur_x++;
+    e->err += e->den;
+  }
+}
+
+/* sort the list of edges by y0, merge sort */
+static uint16_t pg_sort_edges(u8g2_polygon_vertex_t *v, uint16_t list)
+{
+  uint32_t insize = 1;
+  uint32_t psize, qsize;
+  uint16_t p, q, e, tail;
+  uint16_t merges;
+
+  for(;;)
+  {
+    p = list;
+    list = PG_NONE;
+    tail = PG_NONE;
+    merges = 0;
+    while ( p != PG_NONE )
+    {
+      merges++;
+      q = p;
+      psize = 0;
+      while ( psize < insize && q != PG_NONE )
+      {
+	psize++;
+	q = v[q].next;
+      }
+      qsize = insize;
+      while ( psize > 0 || (qsize > 0 && q != PG_NONE) )
+      {
+	if ( psize == 0 || (qsize > 0 && q != PG_NONE && v[q].y0 < v[p].y0) )
+	{
+	  e = q;
+	  q = v[q].next;
+	  qsize--;
+	}
+	else
+	{
+	  e = p;
+	  p = v[p].next;
+	  psize--;
+	}
+	if ( tail == PG_NONE )
+	  list = e;
+	else
+	  v[tail].next = e;
+	tail = e;
+      }
+      p = q;
+    }
+    v[tail].next = PG_NONE;
+    if ( merges <= 1 )
+      return list;
+    insize *= 2;
+  }
+}
+
+/* sort the list of active edges by cur_x, insertion sort, fast if the order did not change */
+static uint16_t pg_sort_active(u8g2_polygon_vertex_t *v, uint16_t list)
+{
+  uint16_t sorted = PG_NONE;
+  uint16_t tail = PG_NONE;
+  uint16_t e, p;
+  
+  while ( list != PG_NONE )
+  {
+    e = list;
+    list = v[e].next;
+    if ( tail == PG_NONE || v[tail].cur_x <= v[e].cur_x )
+    {
+      /* append */
+      v[e].next = PG_NONE;
+      if ( tail == PG_NONE )
+	sorted = e;
+      else
+	v[tail].next = e;
+      tail = e;
+    }
+    else if ( v[e].cur_x <= v[sorted].cur_x )
+    {
+      v[e].next = sorted;
+      sorted = e;
+    }
+    else
+    {
+      p = sorted;
+      while ( v[v[p].next].cur_x < v[e].cur_x )
+	p = v[p].next;
+      v[e].next = v[p].next;
+      v[p].next = e;
+    }
+  }
+  return sorted;
+}
+
+static void pg_span(u8g2_t *u8g2, int32_t x0, int32_t x1, int32_t y)
+{
+  if ( x0 < (int32_t)u8g2->user_x0 )
+    x0 = u8g2->user_x0;
+  if ( x1 > (int32_t)u8g2->user_x1 )
+    x1 = u8g2->user_x1;
+  if ( x0 < x1 )
+    u8g2_DrawHVLine(u8g2, (u8g2_uint_t)x0, (u8g2_uint_t)y, (u8g2_uint_t)(x1 - x0), 0);
+}
+
+/*
+  Fill the polygon with the fill rule of pg. The polygon may be concave
+  and may intersect itself. The vertices are also used as the edge table,
+  so a polygon must not be filled by two threads at the same time.
+*/
+void u8g2_FillPolygon(u8g2_t *u8g2, u8g2_polygon_t *pg)
+{
+  u8g2_polygon_vertex_t *v = pg->vertices;
+  uint16_t cnt = pg->cnt;
+  int32_t wy0 = u8g2->user_y0;
+  int32_t wy1 = u8g2->user_y1;
+  int32_t xa, ya, xb, yb, t;
+  int32_t y, x0;
+  int16_t winding;
+  int8_t dir;
+  uint16_t i, j, e, prev;
+  uint16_t pending = PG_NONE;	/* edges sorted by y0, not yet reached */
+  uint16_t active = PG_NONE;	/* edges crossing the current row */
+  
+  /* build the edge table with the visible edges, horizontal edges are skipped */
+  for( i = 0; i < cnt; i++ )
+  {
+    j = i + 1;
+    if ( j >= cnt )
+      j = 0;
+    xa = v[i].x;
+    ya = v[i].y;
+    xb = v[j].x;
+    yb = v[j].y;
+    if ( ya == yb )
+      continue;
+    dir = 1;
+    if ( ya > yb )
+    {
+      t = xa; xa = xb; xb = t;
+      t = ya; ya = yb; yb = t;
+      dir = -1;
+    }
+    if ( yb <= wy0 || ya >= wy1 )
+      continue;
+    pg_start_edge(v+i, xa, ya, xb, yb, ya < wy0 ? wy0 : ya);
+    v[i].dir = dir;
+    v[i].next = pending;
+    pending = i;
+  }
+  if ( pending == PG_NONE )
+    return;
+  pending = pg_sort_edges(v, pending);
+  
+  y = v[pending].y0;
+  while ( y < wy1 )
+  {
+    /* activate the edges, which start in this row */
+    while ( pending != PG_NONE && v[pending].y0 == y )
+    {
+      e = pending;
+      pending = v[e].next;
+      v[e].next = active;
+      active = e;
+    }
+    active = pg_sort_active(v, active);
+    
+    /* draw the spans between the edges */
+    winding = 0;
+    x0 = 0;
+    for( e = active; e != PG_NONE; e = v[e].next )
+    {
+      if ( pg->fill_rule == U8G2_POLYGON_NON_ZERO )
+      {
+	if ( winding == 0 )
+	  x0 = v[e].cur_x;
+	winding += v[e].dir;
+	if ( winding == 0 )
+	  pg_span(u8g2, x0, v[e].cur_x, y);
+      }
+      else
+      {
+	winding ^= 1;
+	if ( winding != 0 )
+	  x0 = v[e].cur_x;
+	else
+	  pg_span(u8g2, x0, v[e].cur_x, y);
+      }
+    }
+    
+    /* remove the edges, which end in this row, and step the others */
+    y++;
+    prev = PG_NONE;
+    for( e = active; e != PG_NONE; e = v[e].next )
+    {
+      if ( v[e].y1 <= y )
+      {
+	if ( prev == PG_NONE )
+	  active = v[e].next;
+	else
+	  v[prev].next = v[e].next;
+      }
+      else
+      {
+	pg_next_row(v+e);
+	prev = e;
+      }
+    }
+    
+    /* skip the rows without edges */
+    if ( active == PG_NONE )
+    {
+      if ( pending == PG_NONE )
+	break;
+      y = v[pending].y0;
+    }
+  }
+}
+
+#endif /* U8G2_WITH_POLYGON_FILL */
+
+/*===========================================*/
+/* u8g2 API procedures */
+
 pg_struct u8g2_pg;
 
 void u8g2_ClearPolygonXY(void)
@@ -327,20 +640,35 @@ void u8g2_ClearPolygonXY(void)
 
 void u8g2_AddPolygonXY(U8X8_UNUSED u8g2_t *u8g2, int16_t x, int16_t y)
 {
+#ifdef U8G2_WITH_POLYGON_FILL
+  if ( u8g2->polygon != NULL )
+  {
+    u8g2_AddPolygonVertex(u8g2->polygon, x, y);
+    return;
+  }
+#endif /* U8G2_WITH_POLYGON_FILL */
   pg_AddPolygonXY(&u8g2_pg, x, y);
 }
 
 void u8g2_DrawPolygon(u8g2_t *u8g2)
 {
+#ifdef U8G2_WITH_POLYGON_FILL
+  if ( u8g2->polygon != NULL )
+  {
+    u8g2_FillPolygon(u8g2, u8g2->polygon);
+    return;
+  }
+#endif /* U8G2_WITH_POLYGON_FILL */
   pg_DrawPolygon(&u8g2_pg, u8g2);
 }
 
 void u8g2_DrawTriangle(u8g2_t *u8g2, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 {
-  u8g2_ClearPolygonXY();
-  u8g2_AddPolygonXY(u8g2, x0, y0);
-  u8g2_AddPolygonXY(u8g2, x1, y1);
-  u8g2_AddPolygonXY(u8g2, x2, y2);
-  u8g2_DrawPolygon(u8g2);
+  /* local polygon, so that triangles can be drawn by several threads */
+  pg_struct pg;
+  pg_ClearPolygonXY(&pg);
+  pg_AddPolygonXY(&pg, x0, y0);
+  pg_AddPolygonXY(&pg, x1, y1);
+  pg_AddPolygonXY(&pg, x2, y2);
+  pg_DrawPolygon(&pg, u8g2);
 }
-
@@ -76,11 +76,51 @@ void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_
   
   //u8g2->ll_hvline = u8g2_ll_hvline_vertical_top_lsb;
   u8g2->ll_hvline = ll_hvline_cb;
+  if ( ll_hvline_cb == u8g2_ll_hvline_vertical_top_lsb )
+  {
+    u8g2->ll_box = u8g2_ll_box_vertical_top_lsb;
+    u8g2->ll_blit = u8g2_ll_blit_vertical_top_lsb;
+  }
+  else if ( ll_hvline_cb == u8g2_ll_hvline_horizontal_right_lsb )
+  {
+    u8g2->ll_box = u8g2_ll_box_horizontal_right_lsb;
+    u8g2->ll_blit = u8g2_ll_blit_horizontal_right_lsb;
+  }
+  else
+  {
+    u8g2->ll_box = u8g2_ll_box_hvline;
+    u8g2->ll_blit = u8g2_ll_blit_hvline;
+  }
   
   u8g2->tile_buf_ptr = buf;
   u8g2->tile_buf_height = tile_buf_height;
   
   u8g2->tile_curr_row = 0;
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2->dirty_tile_ptr = NULL;
+#endif /* U8G2_WITH_DIRTY_TILES */
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  u8g2->shadow_buf_ptr = NULL;
+  u8g2->is_shadow_valid = 0;
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+#ifdef U8G2_WITH_SPRITES
+  u8g2->sprite_cache = NULL;
+#endif /* U8G2_WITH_SPRITES */
+#ifdef U8G2_WITH_POLYGON_FILL
+  u8g2->polygon = NULL;
+#endif /* U8G2_WITH_POLYGON_FILL */
+#ifdef U8G2_WITH_FONT_INDEX
+  u8g2->font_index_cache = NULL;
+  u8g2->font_index = NULL;
+#endif /* U8G2_WITH_FONT_INDEX */
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2->glyph_cache = NULL;
+#endif /* U8G2_WITH_GLYPH_CACHE */
+#ifdef U8G2_WITH_FONT_METRICS
+  u8g2->font_metrics_cache = NULL;
+  u8g2->font_metrics = NULL;
+  u8g2->str_width_cache = NULL;
+#endif /* U8G2_WITH_FONT_METRICS */
   
   u8g2->font_decode.is_transparent = 0; /* issue 443 */
   u8g2->bitmap_transparency = 0;
@@ -442,15 +482,157 @@ void u8g2_draw_l90_r3(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t le
 }
 
 
+/*============================================*/
+/* box rotation, the box must not be empty */
+extern void u8g2_draw_ll_box(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+
+void u8g2_draw_box_l90_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_draw_ll_box(u8g2, x, y, w, h);
+}
+
+void u8g2_draw_box_l90_mirrorr_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t xx;
+  xx = u8g2->width;
+  xx -= x;
+  xx -= w;
+  u8g2_draw_ll_box(u8g2, xx, y, w, h);
+}
+
+void u8g2_draw_box_mirror_vertical_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t yy;
+  yy = u8g2->height;
+  yy -= y;
+  yy -= h;
+  u8g2_draw_ll_box(u8g2, x, yy, w, h);
+}
+
+void u8g2_draw_box_l90_r1(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t xx;
+  xx = u8g2->height;
+  xx -= y;
+  xx -= h;
+  u8g2_draw_ll_box(u8g2, xx, x, h, w);
+}
+
+void u8g2_draw_box_l90_r2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t xx, yy;
+  xx = u8g2->width;
+  xx -= x;
+  xx -= w;
+  yy = u8g2->height;
+  yy -= y;
+  yy -= h;
+  u8g2_draw_ll_box(u8g2, xx, yy, w, h);
+}
+
+void u8g2_draw_box_l90_r3(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t yy;
+  yy = u8g2->width;
+  yy -= x;
+  yy -= w;
+  u8g2_draw_ll_box(u8g2, y, yy, h, w);
+}
+
+/*============================================*/
+/* 
+  bitmap rotation, the box must not be empty and the bitmap steps of
+  blit must be 1 in the user x and y directions
+*/
+extern void u8g2_draw_ll_blit(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit);
+
+void u8g2_draw_blit_l90_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  u8g2_draw_ll_blit(u8g2, x, y, w, h, blit);
+}
+
+void u8g2_draw_blit_l90_mirrorr_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  u8g2_uint_t xx;
+  u8g2_blit_t b = *blit;
+  xx = u8g2->width;
+  xx -= x;
+  xx -= w;
+  b.sx += w-1;
+  b.dx_x = -1;
+  u8g2_draw_ll_blit(u8g2, xx, y, w, h, &b);
+}
+
+void u8g2_draw_blit_mirror_vertical_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  u8g2_uint_t yy;
+  u8g2_blit_t b = *blit;
+  yy = u8g2->height;
+  yy -= y;
+  yy -= h;
+  b.sy += h-1;
+  b.dy_y = -1;
+  u8g2_draw_ll_blit(u8g2, x, yy, w, h, &b);
+}
+
+void u8g2_draw_blit_l90_r1(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  u8g2_uint_t xx;
+  u8g2_blit_t b = *blit;
+  xx = u8g2->height;
+  xx -= y;
+  xx -= h;
+  /* right in the buffer is up in the bitmap, down is right */
+  b.sy += h-1;
+  b.dx_x = 0;
+  b.dy_x = -1;
+  b.dx_y = 1;
+  b.dy_y = 0;
+  u8g2_draw_ll_blit(u8g2, xx, x, h, w, &b);
+}
+
+void u8g2_draw_blit_l90_r2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  u8g2_uint_t xx, yy;
+  u8g2_blit_t b = *blit;
+  xx = u8g2->width;
+  xx -= x;
+  xx -= w;
+  yy = u8g2->height;
+  yy -= y;
+  yy -= h;
+  b.sx += w-1;
+  b.sy += h-1;
+  b.dx_x = -1;
+  b.dy_y = -1;
+  u8g2_draw_ll_blit(u8g2, xx, yy, w, h, &b);
+}
+
+void u8g2_draw_blit_l90_r3(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit)
+{
+  u8g2_uint_t yy;
+  u8g2_blit_t b = *blit;
+  yy = u8g2->width;
+  yy -= x;
+  yy -= w;
+  /* right in the buffer is down in the bitmap, down is left */
+  b.sx += w-1;
+  b.dx_x = 0;
+  b.dy_x = 1;
+  b.dx_y = -1;
+  b.dy_y = 0;
+  u8g2_draw_ll_blit(u8g2, y, yy, h, w, &b);
+}
+
 
 /*============================================*/
-const u8g2_cb_t u8g2_cb_r0 = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_l90_r0 };
-const u8g2_cb_t u8g2_cb_r1 = { u8g2_update_dimension_r1, u8g2_update_page_win_r1, u8g2_draw_l90_r1 };
-const u8g2_cb_t u8g2_cb_r2 = { u8g2_update_dimension_r2, u8g2_update_page_win_r2, u8g2_draw_l90_r2 };
-const u8g2_cb_t u8g2_cb_r3 = { u8g2_update_dimension_r3, u8g2_update_page_win_r3, u8g2_draw_l90_r3 };
+const u8g2_cb_t u8g2_cb_r0 = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_l90_r0, u8g2_draw_box_l90_r0, u8g2_draw_blit_l90_r0 };
+const u8g2_cb_t u8g2_cb_r1 = { u8g2_update_dimension_r1, u8g2_update_page_win_r1, u8g2_draw_l90_r1, u8g2_draw_box_l90_r1, u8g2_draw_blit_l90_r1 };
+const u8g2_cb_t u8g2_cb_r2 = { u8g2_update_dimension_r2, u8g2_update_page_win_r2, u8g2_draw_l90_r2, u8g2_draw_box_l90_r2, u8g2_draw_blit_l90_r2 };
+const u8g2_cb_t u8g2_cb_r3 = { u8g2_update_dimension_r3, u8g2_update_page_win_r3, u8g2_draw_l90_r3, u8g2_draw_box_l90_r3, u8g2_draw_blit_l90_r3 };
   
-const u8g2_cb_t u8g2_cb_mirror = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_l90_mirrorr_r0 };
-const u8g2_cb_t u8g2_cb_mirror_vertical = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_mirror_vertical_r0 };
+const u8g2_cb_t u8g2_cb_mirror = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_l90_mirrorr_r0, u8g2_draw_box_l90_mirrorr_r0, u8g2_draw_blit_l90_mirrorr_r0 };
+const u8g2_cb_t u8g2_cb_mirror_vertical = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_mirror_vertical_r0, u8g2_draw_box_mirror_vertical_r0, u8g2_draw_blit_mirror_vertical_r0 };
   
 /*============================================*/
 /* setup for the null device */
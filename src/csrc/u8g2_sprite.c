@@ -0,0 +1,472 @@
+/*
+
+  u8g2_sprite.c (libu8g2arm)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  Sprites: XBM bitmaps converted once into the buffer layout.
+
+  u8g2_InitSprite() rotates the bitmap for u8g2->cb and stores 8 copies
+  of it, shifted by 0 to 7 pixels along the bit direction of the buffer
+  bytes (down for vertical_top_lsb, right for horizontal_right_lsb).
+  u8g2_DrawSprite() picks the copy for the sub-byte position of the
+  sprite and combines its bytes with the buffer, without per pixel work.
+
+  A sprite is only drawn this way if it is completely inside the clip
+  window and the rotation and buffer layout have not changed since
+  u8g2_InitSprite(). Otherwise the bitmap is drawn with u8g2_DrawXBM().
+
+  The sprite cache converts the bitmaps given to u8g2_DrawXBM() into
+  sprites, keeping the most recently used ones. Bitmaps are identified
+  by their address: call u8g2_ClearSpriteCache() after changing the
+  content of a bitmap. All memory is provided by the caller.
+
+*/
+
+#include "u8g2.h"
+#include <string.h>
+
+#ifdef U8G2_WITH_SPRITES
+
+/*
+  Set the bitmap origin and steps of blit for the rotation, with the same
+  values as the draw_blit_l90 procedures for a w x h bitmap at 0,0.
+  Returns 0 for rotations which are not known here.
+*/
+static uint8_t u8g2_sprite_get_blit(const u8g2_cb_t *cb, u8g2_uint_t w, u8g2_uint_t h, u8g2_blit_t *blit)
+{
+  blit->sx = 0;
+  blit->sy = 0;
+  blit->dx_x = 1;
+  blit->dy_x = 0;
+  blit->dx_y = 0;
+  blit->dy_y = 1;
+  if ( cb == U8G2_R0 )
+    return 1;
+  if ( cb == U8G2_R1 )
+  {
+    blit->sy = h-1;
+    blit->dx_x = 0;
+    blit->dy_x = -1;
+    blit->dx_y = 1;
+    blit->dy_y = 0;
+    return 1;
+  }
+  if ( cb == U8G2_R2 )
+  {
+    blit->sx = w-1;
+    blit->sy = h-1;
+    blit->dx_x = -1;
+    blit->dy_y = -1;
+    return 1;
+  }
+  if ( cb == U8G2_R3 )
+  {
+    blit->sx = w-1;
+    blit->dx_x = 0;
+    blit->dy_x = 1;
+    blit->dx_y = -1;
+    blit->dy_y = 0;
+    return 1;
+  }
+  if ( cb == U8G2_MIRROR )
+  {
+    blit->sx = w-1;
+    blit->dx_x = -1;
+    return 1;
+  }
+  if ( cb == U8G2_MIRROR_VERTICAL )
+  {
+    blit->sy = h-1;
+    blit->dy_y = -1;
+    return 1;
+  }
+  return 0;
+}
+
+/*
+  Upper left corner in the buffer of a sprite drawn at x,y.
+*/
+static void u8g2_sprite_get_buf_pos(u8g2_t *u8g2, const u8g2_sprite_t *sprite, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t *bx, u8g2_uint_t *by)
+{
+  const u8g2_cb_t *cb = sprite->cb;
+  u8g2_uint_t w = u8g2->width;
+  u8g2_uint_t h = u8g2->height;
+
+  if ( cb == U8G2_R1 )
+  {
+    *bx = h - y - sprite->h;
+    *by = x;
+  }
+  else if ( cb == U8G2_R2 )
+  {
+    *bx = w - x - sprite->w;
+    *by = h - y - sprite->h;
+  }
+  else if ( cb == U8G2_R3 )
+  {
+    *bx = y;
+    *by = w - x - sprite->w;
+  }
+  else if ( cb == U8G2_MIRROR )
+  {
+    *bx = w - x - sprite->w;
+    *by = y;
+  }
+  else if ( cb == U8G2_MIRROR_VERTICAL )
+  {
+    *bx = x;
+    *by = h - y - sprite->h;
+  }
+  else
+  {
+    *bx = x;
+    *by = y;
+  }
+}
+
+/*
+  Number of data bytes for a w x h sprite with the current rotation and
+  buffer layout, 0 if sprites are not supported for them.
+*/
+uint32_t u8g2_GetSpriteDataSize(u8g2_t *u8g2, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_blit_t blit;
+  uint32_t bw, bh;
+
+  if ( u8g2_sprite_get_blit(u8g2->cb, w, h, &blit) == 0 )
+    return 0;
+  bw = w;
+  bh = h;
+  if ( blit.dx_x == 0 )		/* R1, R3 */
+  {
+    bw = h;
+    bh = w;
+  }
+  /* a phase needs one more byte for the shift */
+  if ( u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb )
+    return 8 * bw * ((bh + 7 + 7) >> 3);
+  if ( u8g2->ll_hvline == u8g2_ll_hvline_horizontal_right_lsb )
+    return 8 * bh * ((bw + 7 + 7) >> 3);
+  return 0;
+}
+
+/*
+  Convert the w x h XBM bitmap for the current rotation and buffer layout
+  into data, with u8g2_GetSpriteDataSize() bytes. Returns 0 if this is
+  not supported, in which case the sprite is drawn from the bitmap.
+  The sprite must be initialized again after the rotation is changed.
+*/
+uint8_t u8g2_InitSprite(u8g2_t *u8g2, u8g2_sprite_t *sprite, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, uint8_t *data)
+{
+  u8g2_blit_t blit;
+  u8g2_uint_t i, j;
+  uint8_t p;
+  uint8_t is_vertical;
+  u8g2_uint_t sx, sy;
+  uint8_t *ptr;
+
+  sprite->bitmap = bitmap;
+  sprite->w = w;
+  sprite->h = h;
+  sprite->data = NULL;
+  sprite->cb = u8g2->cb;
+  sprite->ll_hvline = u8g2->ll_hvline;
+  sprite->last_use = 0;
+
+  sprite->phase_size = u8g2_GetSpriteDataSize(u8g2, w, h);
+  if ( sprite->phase_size == 0 || data == NULL || w == 0 || h == 0 )
+    return 0;
+  sprite->phase_size /= 8;
+
+  u8g2_sprite_get_blit(u8g2->cb, w, h, &blit);
+  blit.bitmap = bitmap;
+  blit.stride = (w+7)>>3;
+  blit.is_msb_first = 0;
+  sprite->buf_w = w;
+  sprite->buf_h = h;
+  if ( blit.dx_x == 0 )
+  {
+    sprite->buf_w = h;
+    sprite->buf_h = w;
+  }
+
+  is_vertical = (u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb);
+  if ( is_vertical )
+    sprite->phase_stride = sprite->buf_w;
+  else
+    sprite->phase_stride = (sprite->buf_w + 7 + 7) >> 3;
+
+  memset(data, 0, sprite->phase_size*8);
+  for( j = 0; j < sprite->buf_h; j++ )
+  {
+    for( i = 0; i < sprite->buf_w; i++ )
+    {
+      sx = blit.sx + blit.dx_x*i + blit.dx_y*j;
+      sy = blit.sy + blit.dy_x*i + blit.dy_y*j;
+      if ( u8g2_blit_pixel(&blit, sx, sy) == 0 )
+	continue;
+      for( p = 0; p < 8; p++ )
+      {
+	ptr = data + p*sprite->phase_size;
+	if ( is_vertical )
+	  ptr[((j+p)>>3)*sprite->phase_stride + i] |= 1 << ((j+p)&7);
+	else
+	  ptr[j*sprite->phase_stride + ((i+p)>>3)] |= 0x80 >> ((i+p)&7);
+      }
+    }
+  }
+  sprite->data = data;
+  return 1;
+}
+
+/*
+  Combine cnt bytes of a sprite phase with the buffer. mask has the bits
+  which belong to the sprite, the bits outside mask are 0 in src.
+  mode is the draw color, plus 3 for solid bitmaps.
+*/
+static void u8g2_sprite_draw_bytes(uint8_t *dest, const uint8_t *src, u8g2_uint_t cnt, uint8_t mask, uint8_t mode)
+{
+  uint8_t d;
+  switch(mode)
+  {
+    case 0:	/* transparent, color 0 */
+      while( cnt-- > 0 )
+	*dest++ &= ~*src++;
+      break;
+    case 1:	/* transparent, color 1 */
+      while( cnt-- > 0 )
+	*dest++ |= *src++;
+      break;
+    case 2:	/* transparent, XOR */
+      while( cnt-- > 0 )
+	*dest++ ^= *src++;
+      break;
+    case 3:	/* solid, color 0: clear set pixels, set the others */
+      while( cnt-- > 0 )
+      {
+	*dest = (*dest & ~mask) | (~*src & mask);
+	dest++;
+	src++;
+      }
+      break;
+    case 4:	/* solid, color 1: copy */
+      while( cnt-- > 0 )
+      {
+	*dest = (*dest & ~mask) | *src++;
+	dest++;
+      }
+      break;
+    default:	/* solid, XOR: unset pixels are drawn with color 0 */
+      while( cnt-- > 0 )
+      {
+	d = *dest;
+	*dest++ = (d & ~mask) | (*src++ & ~d);
+      }
+      break;
+  }
+}
+
+static void u8g2_sprite_draw_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const u8g2_sprite_t *sprite, uint8_t mode)
+{
+  const uint8_t *src;
+  uint8_t *dest;
+  uint8_t p = y & 7;
+  u8g2_uint_t pages = (p + sprite->buf_h + 7) >> 3;
+  u8g2_uint_t k;
+  uint16_t lo, hi;
+  uint8_t mask;
+
+  src = sprite->data + p*sprite->phase_size;
+  dest = u8g2->tile_buf_ptr + (uint32_t)(y>>3)*u8g2->pixel_buf_width + x;
+  for( k = 0; k < pages; k++ )
+  {
+    /* rows of the sprite within page k */
+    lo = k == 0 ? p : 0;
+    hi = p + sprite->buf_h - k*8;
+    if ( hi > 8 )
+      hi = 8;
+    mask = (0xff >> (8 - (hi - lo))) << lo;
+    u8g2_sprite_draw_bytes(dest, src, sprite->buf_w, mask, mode);
+    src += sprite->phase_stride;
+    dest += u8g2->pixel_buf_width;
+  }
+}
+
+static void u8g2_sprite_draw_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const u8g2_sprite_t *sprite, uint8_t mode)
+{
+  const uint8_t *src;
+  uint8_t *dest;
+  uint8_t p = x & 7;
+  uint8_t tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  u8g2_uint_t cnt = (p + sprite->buf_w + 7) >> 3;	/* bytes per line */
+  uint8_t first_mask = 0xff >> p;
+  uint8_t last_mask = 0xff << (7 - ((p + sprite->buf_w - 1) & 7));
+  u8g2_uint_t j;
+
+  if ( cnt == 1 )
+    first_mask &= last_mask;
+  src = sprite->data + p*sprite->phase_size;
+  dest = u8g2->tile_buf_ptr + (uint32_t)y*tile_width + (x>>3);
+  for( j = 0; j < sprite->buf_h; j++ )
+  {
+    u8g2_sprite_draw_bytes(dest, src, 1, first_mask, mode);
+    if ( cnt > 1 )
+    {
+      u8g2_sprite_draw_bytes(dest+1, src+1, cnt-2, 0xff, mode);
+      u8g2_sprite_draw_bytes(dest+cnt-1, src+cnt-1, 1, last_mask, mode);
+    }
+    src += sprite->phase_stride;
+    dest += tile_width;
+  }
+}
+
+/*
+  Draw the sprite at x,y, like u8g2_DrawXBM() draws its bitmap.
+*/
+void u8g2_DrawSprite(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const u8g2_sprite_t *sprite)
+{
+  u8g2_uint_t bx, by;
+  uint8_t mode;
+
+#ifdef U8G2_WITH_INTERSECTION
+  if ( u8g2_IsIntersection(u8g2, x, y, x+sprite->w, y+sprite->h) == 0 )
+    return;
+#endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection == 0 )
+    return;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+
+  /* the phases can only be used if nothing has to be clipped */
+  if ( sprite->data == NULL
+    || sprite->cb != u8g2->cb
+    || sprite->ll_hvline != u8g2->ll_hvline
+    || x < u8g2->user_x0 || (uint32_t)x + sprite->w > u8g2->user_x1
+    || y < u8g2->user_y0 || (uint32_t)y + sprite->h > u8g2->user_y1 )
+  {
+    u8g2_draw_bitmap_box(u8g2, x, y, sprite->w, sprite->h, (sprite->w+7)>>3, 0, sprite->bitmap);
+    return;
+  }
+
+  u8g2_sprite_get_buf_pos(u8g2, sprite, x, y, &bx, &by);
+  by -= u8g2->pixel_curr_row;
+
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_ptr != NULL )
+    u8g2_mark_dirty_tiles(u8g2, bx>>3, by>>3, (bx+sprite->buf_w-1)>>3, (by+sprite->buf_h-1)>>3);
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+  mode = u8g2->draw_color;
+  if ( mode > 2 )
+    mode = 2;
+  if ( u8g2->bitmap_transparency == 0 )
+    mode += 3;
+  if ( sprite->ll_hvline == u8g2_ll_hvline_vertical_top_lsb )
+    u8g2_sprite_draw_vertical_top_lsb(u8g2, bx, by, sprite, mode);
+  else
+    u8g2_sprite_draw_horizontal_right_lsb(u8g2, bx, by, sprite, mode);
+}
+
+/*
+  cnt		number of sprites
+  sprites	cnt sprites, used by the cache
+  data		cnt * slot_size bytes
+  slot_size	data bytes for each sprite, see u8g2_GetSpriteDataSize()
+*/
+void u8g2_InitSpriteCache(u8g2_sprite_cache_t *cache, u8g2_sprite_t *sprites, uint16_t cnt, uint8_t *data, uint32_t slot_size)
+{
+  cache->sprites = sprites;
+  cache->data = data;
+  cache->cnt = cnt;
+  cache->slot_size = slot_size;
+  u8g2_ClearSpriteCache(cache);
+}
+
+/* Remove all sprites and reset the counters */
+void u8g2_ClearSpriteCache(u8g2_sprite_cache_t *cache)
+{
+  uint16_t i;
+  for( i = 0; i < cache->cnt; i++ )
+  {
+    cache->sprites[i].bitmap = NULL;
+    cache->sprites[i].last_use = 0;
+  }
+  cache->clock = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+}
+
+/* Use the cache for u8g2_DrawXBM() and u8g2_DrawXBMP(), NULL to stop */
+void u8g2_SetSpriteCache(u8g2_t *u8g2, u8g2_sprite_cache_t *cache)
+{
+  u8g2->sprite_cache = cache;
+}
+
+/*
+  u8g2_DrawXBM() with the sprite cache: draw the sprite of the bitmap,
+  converting it into the least recently used sprite if it is not in the
+  cache. The sprites of other rotations or sizes are not reused.
+*/
+void u8g2_draw_cached_sprite(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  u8g2_sprite_cache_t *cache = u8g2->sprite_cache;
+  u8g2_sprite_t *sprite;
+  u8g2_sprite_t *lru = NULL;
+  uint32_t size;
+  uint16_t i;
+
+  cache->clock++;
+  for( i = 0; i < cache->cnt; i++ )
+  {
+    sprite = cache->sprites + i;
+    if ( sprite->bitmap == bitmap && sprite->w == w && sprite->h == h
+      && sprite->cb == u8g2->cb && sprite->ll_hvline == u8g2->ll_hvline )
+    {
+      cache->hits++;
+      sprite->last_use = cache->clock;
+      u8g2_DrawSprite(u8g2, x, y, sprite);
+      return;
+    }
+    if ( lru == NULL || sprite->last_use < lru->last_use )
+      lru = sprite;
+  }
+
+  cache->misses++;
+  size = u8g2_GetSpriteDataSize(u8g2, w, h);
+  if ( lru == NULL || size == 0 || size > cache->slot_size )
+  {
+    u8g2_draw_bitmap_box(u8g2, x, y, w, h, (w+7)>>3, 0, bitmap);
+    return;
+  }
+  u8g2_InitSprite(u8g2, lru, w, h, bitmap, cache->data + (uint32_t)(lru - cache->sprites)*cache->slot_size);
+  lru->last_use = cache->clock;
+  u8g2_DrawSprite(u8g2, x, y, lru);
+}
+
+#endif /* U8G2_WITH_SPRITES */
@@ -0,0 +1,278 @@
+/*
+
+  u8g2_text_atom.c (libu8g2arm)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  Text atoms: strings rendered once and drawn as sprites.
+
+  u8g2_DrawStr() and u8g2_DrawUTF8() search and decode each glyph of
+  the string on every draw. A text atom is built from a string with the
+  current font, font direction, reference position and font mode: the
+  glyphs are decoded once into an XBM bitmap of the bounding box of the
+  string, which is converted into a sprite (see u8g2_sprite.c) for the
+  buffer layout and rotation. u8g2_DrawTextAtom() draws the sprite with
+  the current draw color.
+
+  In transparent mode, an atom draws the same pixels as u8g2_DrawStr().
+  In solid mode, the background of the whole bounding box is drawn,
+  including the gaps between the glyph boxes. With XOR (draw color 2),
+  pixels of overlapping glyphs are inverted once.
+
+  All memory is provided by the caller, see u8g2_GetStrAtomDataSize().
+
+*/
+
+#include "u8g2.h"
+#include <string.h>
+
+#ifdef U8G2_WITH_TEXT_ATOMS
+
+/*
+  Walk the glyphs of str, with u8g2->u8x8.next_cb, as u8g2_DrawStr()
+  places them at 0,0. If bitmap is NULL, set the box of the atom (the
+  offset, and the size in the sprite) and the delta, otherwise decode
+  the glyphs into the bitmap of the box.
+*/
+static void u8g2_text_atom_walk(u8g2_t *u8g2, const char *str, u8g2_text_atom_t *atom, uint8_t *bitmap)
+{
+  u8g2_font_decode_t decode;
+  u8g2_glyph_header_t header;
+  const uint8_t *glyph_data;
+  u8g2_uint_t x = 0, y = 0;
+  u8g2_uint_t bx, by, bw, bh, delta;
+  int32_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+  uint16_t e;
+  uint8_t dir = 0;
+  uint8_t is_empty = 1;
+
+#ifdef U8G2_WITH_FONT_ROTATION
+  dir = u8g2->font_decode.dir;
+  switch(dir)
+  {
+    case 0:
+      y += u8g2->font_calc_vref(u8g2);
+      break;
+    case 1:
+      x -= u8g2->font_calc_vref(u8g2);
+      break;
+    case 2:
+      y -= u8g2->font_calc_vref(u8g2);
+      break;
+    case 3:
+      x += u8g2->font_calc_vref(u8g2);
+      break;
+  }
+#else
+  y += u8g2->font_calc_vref(u8g2);
+#endif
+
+  atom->delta = 0;
+  u8x8_utf8_init(u8g2_GetU8x8(u8g2));
+  for(;;)
+  {
+    e = u8g2->u8x8.next_cb(u8g2_GetU8x8(u8g2), (uint8_t)*str);
+    if ( e == 0x0ffff )
+      break;
+    str++;
+    if ( e == 0x0fffe )
+      continue;
+
+    delta = 0;
+    glyph_data = u8g2_font_get_glyph_data(u8g2, e);
+    if ( glyph_data != NULL )
+    {
+      u8g2_font_read_glyph_header(u8g2, &decode, glyph_data, &header);
+      delta = header.d;
+      if ( header.w > 0 && header.h > 0 )
+      {
+	u8g2_font_get_glyph_box(&header, dir, x, y, &bx, &by, &bw, &bh);
+	if ( bitmap != NULL )
+	{
+	  u8g2_font_decode_glyph_xbm(u8g2, &decode, &header, bitmap, (atom->sprite.w+7)>>3, bx - atom->off_x, by - atom->off_y, dir);
+	}
+	else
+	{
+	  /* positions relative to the string position are small, take them as signed */
+	  if ( is_empty || (u8g2_int_t)bx < x0 )
+	    x0 = (u8g2_int_t)bx;
+	  if ( is_empty || (u8g2_int_t)by < y0 )
+	    y0 = (u8g2_int_t)by;
+	  if ( is_empty || (u8g2_int_t)bx + (int32_t)bw > x1 )
+	    x1 = (u8g2_int_t)bx + (int32_t)bw;
+	  if ( is_empty || (u8g2_int_t)by + (int32_t)bh > y1 )
+	    y1 = (u8g2_int_t)by + (int32_t)bh;
+	  is_empty = 0;
+	}
+      }
+    }
+
+#ifdef U8G2_WITH_FONT_ROTATION
+    switch(dir)
+    {
+      case 0:
+	x += delta;
+	break;
+      case 1:
+	y += delta;
+	break;
+      case 2:
+	x -= delta;
+	break;
+      case 3:
+	y -= delta;
+	break;
+    }
+#else
+    x += delta;
+#endif
+    atom->delta += delta;
+  }
+
+  if ( bitmap == NULL )
+  {
+    atom->off_x = (u8g2_uint_t)x0;
+    atom->off_y = (u8g2_uint_t)y0;
+    atom->sprite.w = (u8g2_uint_t)(x1 - x0);
+    atom->sprite.h = (u8g2_uint_t)(y1 - y0);
+  }
+}
+
+static uint32_t u8g2_text_atom_get_bitmap_size(u8g2_uint_t w, u8g2_uint_t h)
+{
+  return (uint32_t)((w+7)>>3)*h;
+}
+
+static uint32_t u8g2_text_atom_get_data_size(u8g2_t *u8g2, const char *str)
+{
+  u8g2_text_atom_t atom;
+
+  u8g2_text_atom_walk(u8g2, str, &atom, NULL);
+  if ( atom.sprite.w == 0 || atom.sprite.h == 0 )
+    return 0;
+  return u8g2_text_atom_get_bitmap_size(atom.sprite.w, atom.sprite.h) + u8g2_GetSpriteDataSize(u8g2, atom.sprite.w, atom.sprite.h);
+}
+
+/*
+  Convert the bitmap of the atom into a sprite for the current rotation
+  and buffer layout, or leave the sprite without data, if the sprite does
+  not fit into the data of the atom.
+*/
+static void u8g2_text_atom_init_sprite(u8g2_t *u8g2, u8g2_text_atom_t *atom, u8g2_uint_t w, u8g2_uint_t h)
+{
+  uint32_t bitmap_size = u8g2_text_atom_get_bitmap_size(w, h);
+  uint32_t sprite_size = u8g2_GetSpriteDataSize(u8g2, w, h);
+
+  u8g2_InitSprite(u8g2, &(atom->sprite), w, h, atom->data,
+    bitmap_size + sprite_size <= atom->size ? atom->data + bitmap_size : NULL);
+}
+
+/* u8g2->u8x8.next_cb must be set, width is the width of the string */
+static uint8_t u8g2_init_text_atom(u8g2_t *u8g2, u8g2_text_atom_t *atom, const char *str, uint8_t *data, uint32_t size, u8g2_uint_t width)
+{
+  uint32_t bitmap_size;
+  u8g2_uint_t w, h;
+
+  atom->data = data;
+  atom->size = size;
+  atom->width = width;
+  atom->is_transparent = u8g2->font_decode.is_transparent;
+
+  u8g2_text_atom_walk(u8g2, str, atom, NULL);
+  w = atom->sprite.w;
+  h = atom->sprite.h;
+  bitmap_size = u8g2_text_atom_get_bitmap_size(w, h);
+  if ( w == 0 || h == 0 || bitmap_size > size )
+  {
+    u8g2_InitSprite(u8g2, &(atom->sprite), 0, 0, NULL, NULL);
+    return w == 0 || h == 0;
+  }
+
+  memset(data, 0, bitmap_size);
+  u8g2_text_atom_walk(u8g2, str, atom, data);
+  u8g2_text_atom_init_sprite(u8g2, atom, w, h);
+  return 1;
+}
+
+/*
+  Bytes of data for an atom of the string, with the current font, font
+  direction and reference position, for the current rotation and buffer
+  layout. 0 if the string has no pixels.
+*/
+uint32_t u8g2_GetStrAtomDataSize(u8g2_t *u8g2, const char *str)
+{
+  u8g2->u8x8.next_cb = u8x8_ascii_next;
+  return u8g2_text_atom_get_data_size(u8g2, str);
+}
+
+uint32_t u8g2_GetUTF8AtomDataSize(u8g2_t *u8g2, const char *str)
+{
+  u8g2->u8x8.next_cb = u8x8_utf8_next;
+  return u8g2_text_atom_get_data_size(u8g2, str);
+}
+
+/*
+  Render the string into the atom, with the current font, font direction,
+  reference position and font mode. data must have size bytes, see
+  u8g2_GetStrAtomDataSize(); with less bytes the atom is drawn from its
+  bitmap, or draws nothing if the bitmap does not fit. Returns 0 in the
+  last case. The string is not used after this call.
+*/
+uint8_t u8g2_InitStrAtom(u8g2_t *u8g2, u8g2_text_atom_t *atom, const char *str, uint8_t *data, uint32_t size)
+{
+  u8g2_uint_t width = u8g2_GetStrWidth(u8g2, str);
+  return u8g2_init_text_atom(u8g2, atom, str, data, size, width);
+}
+
+uint8_t u8g2_InitUTF8Atom(u8g2_t *u8g2, u8g2_text_atom_t *atom, const char *str, uint8_t *data, uint32_t size)
+{
+  u8g2_uint_t width = u8g2_GetUTF8Width(u8g2, str);
+  return u8g2_init_text_atom(u8g2, atom, str, data, size, width);
+}
+
+/*
+  Draw the atom at x,y, which is the position given to u8g2_DrawStr(),
+  with the current draw color and the font mode of the atom. Returns the
+  value of u8g2_DrawStr() for the string.
+*/
+u8g2_uint_t u8g2_DrawTextAtom(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_text_atom_t *atom)
+{
+  uint8_t bitmap_transparency;
+
+  if ( atom->sprite.w == 0 || atom->sprite.h == 0 )
+    return atom->delta;
+  if ( atom->sprite.cb != u8g2->cb || atom->sprite.ll_hvline != u8g2->ll_hvline )
+    u8g2_text_atom_init_sprite(u8g2, atom, atom->sprite.w, atom->sprite.h);
+
+  bitmap_transparency = u8g2->bitmap_transparency;
+  u8g2->bitmap_transparency = (atom->is_transparent != 0);
+  u8g2_DrawSprite(u8g2, x + atom->off_x, y + atom->off_y, &(atom->sprite));
+  u8g2->bitmap_transparency = bitmap_transparency;
+  return atom->delta;
+}
+
+#endif /* U8G2_WITH_TEXT_ATOMS */
@@ -0,0 +1,304 @@
+/*
+
+  U8g2Fast.h (libu8g2arm)
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  Pixels, lines and boxes drawn with the buffer layout and the rotation
+  as template parameters. The clipping, the rotation and the writes into
+  the buffer of the U8G2 object are inlined, instead of the calls through
+  u8g2->cb->draw_l90 and u8g2->ll_hvline, and the draw color can be a
+  template parameter as well. Only pixels, horizontal and vertical lines
+  and boxes are specialised; use the U8G2 object for everything else.
+  The gain depends on inlining, build with optimisation (-O2).
+
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0);
+    U8G2Fast<U8G2FastLayout::VerticalTopLsb, U8G2FastRotation::R0> fast(u8g2);
+
+    fast.drawBox(0, 0, 10, 10);		// current draw color
+    fast.drawHLine<2>(0, 20, 128);		// XOR
+
+  The pixels are the same as for the U8G2 procedures, including clipping
+  and page buffers, and dirty tiles are marked, so that sendBuffer() and
+  the picture loop are unchanged. If the display has another layout or
+  rotation (e.g. after setDisplayRotation()), the U8G2 procedures are used.
+  As for U8G2_MIRROR_VERTICAL, MirrorVertical needs a full buffer.
+
+*/
+
+#ifndef U8G2FAST_HH
+#define U8G2FAST_HH
+
+#include "U8g2lib.h"
+
+#include <string.h>
+
+enum class U8G2FastLayout
+{
+  VerticalTopLsb,		/* u8g2_ll_hvline_vertical_top_lsb, e.g. SSD1306 */
+  HorizontalRightLsb		/* u8g2_ll_hvline_horizontal_right_lsb, e.g. ST7920 */
+};
+
+enum class U8G2FastRotation
+{
+  R0,				/* U8G2_R0 */
+  R1,				/* U8G2_R1 */
+  R2,				/* U8G2_R2 */
+  R3,				/* U8G2_R3 */
+  Mirror,			/* U8G2_MIRROR */
+  MirrorVertical		/* U8G2_MIRROR_VERTICAL */
+};
+
+template <U8G2FastLayout layout, U8G2FastRotation rotation>
+class U8G2Fast
+{
+  protected:
+    u8g2_t *u8g2;
+
+    static const u8g2_cb_t *getCb(void) {
+      return rotation == U8G2FastRotation::R0 ? &u8g2_cb_r0 :
+             rotation == U8G2FastRotation::R1 ? &u8g2_cb_r1 :
+             rotation == U8G2FastRotation::R2 ? &u8g2_cb_r2 :
+             rotation == U8G2FastRotation::R3 ? &u8g2_cb_r3 :
+             rotation == U8G2FastRotation::Mirror ? &u8g2_cb_mirror :
+             &u8g2_cb_mirror_vertical;
+    }
+
+    static u8g2_draw_ll_hvline_cb getLLHVLine(void) {
+      return layout == U8G2FastLayout::VerticalTopLsb ?
+        u8g2_ll_hvline_vertical_top_lsb : u8g2_ll_hvline_horizontal_right_lsb;
+    }
+
+    /* clip pos..pos+len (excluded) against c..d (excluded), like u8g2_clip_intersection2() */
+    static bool clip(u8g2_uint_t &pos, u8g2_uint_t &len, u8g2_uint_t c, u8g2_uint_t d) {
+      u8g2_uint_t a = pos;
+      u8g2_uint_t b = a + len;
+      if ( a > b ) {
+        /* negative a, wrapped around */
+        if ( a < d )
+          b = d - 1;
+        else
+          a = c;
+      }
+      if ( a >= d || b <= c )
+        return false;
+      if ( a < c )
+        a = c;
+      if ( b > d )
+        b = d;
+      pos = a;
+      len = b - a;
+      return true;
+    }
+
+    /* apply the color to the bits of mask */
+    template <uint8_t color> static void apply(uint8_t *ptr, uint8_t mask) {
+      if ( color == 0 )
+        *ptr &= ~mask;
+      else if ( color == 1 )
+        *ptr |= mask;
+      else
+        *ptr ^= mask;
+    }
+
+    /* apply the color to the bits of mask in n bytes, 8 bytes at a time */
+    template <uint8_t color> static void applyBytes(uint8_t *ptr, u8g2_uint_t n, uint8_t mask) {
+      if ( mask == 0xff && color <= 1 ) {
+        memset(ptr, color == 0 ? 0 : 0xff, n);
+        return;
+      }
+      uint64_t word_mask = (uint64_t)mask * 0x0101010101010101ULL;
+      while ( n >= 8 ) {
+        uint64_t w;
+        memcpy(&w, ptr, 8);
+        if ( color == 0 )
+          w &= ~word_mask;
+        else if ( color == 1 )
+          w |= word_mask;
+        else
+          w ^= word_mask;
+        memcpy(ptr, &w, 8);
+        ptr += 8;
+        n -= 8;
+      }
+      while ( n != 0 ) {
+        apply<color>(ptr++, mask);
+        n--;
+      }
+    }
+
+    /* box at x,y of the buffer, already clipped, w and h not 0 */
+    template <uint8_t color> void storeBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+      uint16_t tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+
+      y -= u8g2->pixel_curr_row;
+#ifdef U8G2_WITH_DIRTY_TILES
+      if ( u8g2->dirty_tile_ptr != NULL )
+        u8g2_mark_dirty_tiles(u8g2, x>>3, y>>3, (x+w-1)>>3, (y+h-1)>>3);
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+      if ( layout == U8G2FastLayout::VerticalTopLsb ) {
+        /* a byte is 8 pixels of a column, lsb on top, pages of tile_width*8 bytes */
+        uint8_t *page = u8g2->tile_buf_ptr + (uint32_t)(y>>3)*tile_width*8 + x;
+        u8g2_uint_t bit = y & 7;
+        while ( h != 0 ) {
+          u8g2_uint_t bits = 8 - bit;
+          if ( bits > h )
+            bits = h;
+          uint8_t mask = (uint8_t)(((1u << bits) - 1) << bit);
+          if ( w == 1 )
+            apply<color>(page, mask);
+          else
+            applyBytes<color>(page, w, mask);
+          page += tile_width*8;
+          h -= bits;
+          bit = 0;
+        }
+      }
+      else {
+        /* a byte is 8 pixels of a line, msb on the left, lines of tile_width bytes */
+        uint8_t *line = u8g2->tile_buf_ptr + (uint32_t)y*tile_width + (x>>3);
+        u8g2_uint_t bit = x & 7;
+        u8g2_uint_t first_bits = 8 - bit;
+        uint8_t first_mask, last_mask;
+        u8g2_uint_t full;
+        if ( first_bits >= w ) {
+          /* within one byte of each line */
+          first_mask = (uint8_t)((0xff >> bit) & (0xff << (first_bits - w)));
+          do {
+            apply<color>(line, first_mask);
+            line += tile_width;
+          } while( --h != 0 );
+          return;
+        }
+        first_mask = (uint8_t)(0xff >> bit);
+        full = (w - first_bits) >> 3;
+        last_mask = 0;
+        if ( ((w - first_bits) & 7) != 0 )
+          last_mask = (uint8_t)(0xff << (8 - ((w - first_bits) & 7)));
+        do {
+          uint8_t *ptr = line;
+          apply<color>(ptr++, first_mask);
+          if ( full != 0 ) {
+            applyBytes<color>(ptr, full, 0xff);
+            ptr += full;
+          }
+          if ( last_mask != 0 )
+            apply<color>(ptr, last_mask);
+          line += tile_width;
+        } while( --h != 0 );
+      }
+    }
+
+    /* box at x,y of the user, w and h not 0 */
+    template <uint8_t color> void box(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+      if ( u8g2->cb != getCb() || u8g2->ll_hvline != getLLHVLine() ) {
+        /* not the layout or rotation of this class */
+        uint8_t draw_color = u8g2->draw_color;
+        u8g2->draw_color = color;
+        u8g2_DrawHVBox(u8g2, x, y, w, h);
+        u8g2->draw_color = draw_color;
+        return;
+      }
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+      if ( u8g2->is_page_clip_window_intersection == 0 )
+        return;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+      if ( !clip(x, w, u8g2->user_x0, u8g2->user_x1) )
+        return;
+      if ( !clip(y, h, u8g2->user_y0, u8g2->user_y1) )
+        return;
+
+      /* rotate into the buffer, see u8g2_draw_l90_r0() .. u8g2_draw_l90_r3() */
+      switch( rotation ) {
+        case U8G2FastRotation::R0:
+          storeBox<color>(x, y, w, h);
+          break;
+        case U8G2FastRotation::R1:
+          storeBox<color>(u8g2->height - y - h, x, h, w);
+          break;
+        case U8G2FastRotation::R2:
+          storeBox<color>(u8g2->width - x - w, u8g2->height - y - h, w, h);
+          break;
+        case U8G2FastRotation::R3:
+          storeBox<color>(y, u8g2->width - x - w, h, w);
+          break;
+        case U8G2FastRotation::Mirror:
+          storeBox<color>(u8g2->width - x - w, y, w, h);
+          break;
+        case U8G2FastRotation::MirrorVertical:
+          storeBox<color>(x, u8g2->height - y - h, w, h);
+          break;
+      }
+    }
+
+  public:
+    U8G2Fast(class U8G2 &u8g2) : u8g2(u8g2.getU8g2()) { }
+
+    /* true if the display has this buffer layout and rotation, otherwise the U8G2 procedures are used */
+    bool isCompatible(void) const {
+      return u8g2->cb == getCb() && u8g2->ll_hvline == getLLHVLine();
+    }
+
+    /* with the color as template parameter: 0 (clear), 1 (set) or 2 (XOR) */
+    template <uint8_t color> void drawPixel(u8g2_uint_t x, u8g2_uint_t y) { box<color>(x, y, 1, 1); }
+    template <uint8_t color> void drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w) { if ( w != 0 ) box<color>(x, y, w, 1); }
+    template <uint8_t color> void drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h) { if ( h != 0 ) box<color>(x, y, 1, h); }
+    template <uint8_t color> void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) { if ( w != 0 && h != 0 ) box<color>(x, y, w, h); }
+
+    /* with the draw color of the U8G2 object */
+    void drawPixel(u8g2_uint_t x, u8g2_uint_t y) {
+      switch( u8g2->draw_color ) {
+        case 0: drawPixel<0>(x, y); break;
+        case 1: drawPixel<1>(x, y); break;
+        default: drawPixel<2>(x, y); break;
+      }
+    }
+    void drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w) {
+      switch( u8g2->draw_color ) {
+        case 0: drawHLine<0>(x, y, w); break;
+        case 1: drawHLine<1>(x, y, w); break;
+        default: drawHLine<2>(x, y, w); break;
+      }
+    }
+    void drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h) {
+      switch( u8g2->draw_color ) {
+        case 0: drawVLine<0>(x, y, h); break;
+        case 1: drawVLine<1>(x, y, h); break;
+        default: drawVLine<2>(x, y, h); break;
+      }
+    }
+    void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+      switch( u8g2->draw_color ) {
+        case 0: drawBox<0>(x, y, w, h); break;
+        case 1: drawBox<1>(x, y, w, h); break;
+        default: drawBox<2>(x, y, w, h); break;
+      }
+    }
+};
+
+#endif /* U8G2FAST_HH */
@@ -0,0 +1,60 @@
+/*
+ Licence: CC0/Public Domain http://creativecommons.org/publicdomain/zero/1.0/
+
+ libu8g2arm asynchronous u8g2_SendBuffer() from a transmit thread
+*/
+
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "u8g2.h"
+
+// Asynchronous u8g2_SendBuffer() for full buffer (_f) displays. The frame
+// is copied to a transmit buffer and sent by a separate thread, while
+// drawing continues into the U8g2 buffer, which keeps its contents as it
+// does after u8g2_SendBuffer(). Other functions that access the display
+// (e.g. u8g2_SetPowerSave() or u8g2_SetContrast()) must not be called
+// while a frame is being sent, call u8g2arm_arm_async_wait() first.
+
+// Policy for a frame sent while the previous frame is still being sent
+//   U8G2ARM_ASYNC_BLOCK    - wait until the previous frame has been sent
+//   U8G2ARM_ASYNC_DROP     - discard the new frame
+//   U8G2ARM_ASYNC_COALESCE - hold the new frame, replacing any frame
+//                            already held, and send it next
+#define U8G2ARM_ASYNC_BLOCK    0
+#define U8G2ARM_ASYNC_DROP     1
+#define U8G2ARM_ASYNC_COALESCE 2
+
+typedef struct u8g2arm_async_t u8g2arm_async_t;
+
+// Start the transmit thread for a display, after the display has been
+// initialised (returns NULL if the display does not have a full buffer,
+// or the thread could not be started)
+u8g2arm_async_t *u8g2arm_arm_async_start(u8g2_t *u8g2, int policy);
+
+// Set the policy for a frame sent while another is being sent
+int u8g2arm_arm_async_set_policy(u8g2arm_async_t *async, int policy);
+
+// Hand the current U8g2 buffer to the transmit thread (returns 1 if the
+// frame will be sent, 0 if it was discarded by U8G2ARM_ASYNC_DROP)
+int u8g2arm_arm_async_send_buffer(u8g2arm_async_t *async);
+
+// Wait until all the frames handed to the thread have been sent
+void u8g2arm_arm_async_wait(u8g2arm_async_t *async);
+
+// Number of frames sent, and not sent (discarded or replaced)
+unsigned long u8g2arm_arm_async_frames_sent(u8g2arm_async_t *async);
+unsigned long u8g2arm_arm_async_frames_skipped(u8g2arm_async_t *async);
+
+// Send any held frame, stop the thread and free the transmit buffers
+void u8g2arm_arm_async_stop(u8g2arm_async_t *async);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -50,4 +50,41 @@ int getGPIODirection(int pin);
 int setGPIOValue(int pin, int value);
 int getGPIOValue(int pin);
 
+// Maximum number of pins handled in one call of the functions below
+#define GPIO_MAX_PINS           (32)
+
+// Number of pins held by a chip (pin numbers 0-255)
+#define GPIO_PIN_CNT            (256)
+
+// Chip opened when no chip path is given
+#define GPIO_DEFAULT_CHIP       "/dev/gpiochip0"
+
+// A GPIO chip with the pins requested from it. The functions above, and
+// the functions below when passed a NULL chip, use a chip shared by the
+// whole process. Open a chip for each display to drive several displays
+// from separate threads.
+typedef struct gpio_chip_t gpio_chip_t;
+
+// Open a GPIO chip, e.g. "/dev/gpiochip0" (NULL for GPIO_DEFAULT_CHIP).
+// The path is not used with sysfs.
+gpio_chip_t *openGPIOChip(const char *chip_path);
+
+// Release all the pins requested from a chip and close it
+void closeGPIOChip(gpio_chip_t *chip);
+
+// Export several pins as outputs set to value (GPIO_LOW or GPIO_HIGH).
+// With libgpiod the pins are requested together as a single request.
+int exportGPIOOutputs(const int *pins, int count, int value);
+int exportGPIOChipOutputs(gpio_chip_t *chip, const int *pins, int count,
+                          int value);
+
+// Set a pin of a chip to GPIO_LOW or GPIO_HIGH
+int setGPIOChipValue(gpio_chip_t *chip, int pin, int value);
+
+// Set several pins to GPIO_LOW or GPIO_HIGH. With libgpiod the pins of
+// a single request are set together with one call.
+int setGPIOValues(const int *pins, const int *values, int count);
+int setGPIOChipValues(gpio_chip_t *chip, const int *pins, const int *values,
+                      int count);
+
 #endif
@@ -34,10 +34,16 @@
 
 #define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
 
+// spidev buffer size used when /sys/module/spidev/parameters/bufsiz
+// cannot be read
+#define SPI_DEFAULT_BUFSIZ 4096
+
 void pabort(const char *s);
 
 int openSPIDevice(const char* device, uint8_t mode, uint8_t bits, uint32_t speed);
 int SPITransfer(int fd, struct spi_ioc_transfer* tr);
+int SPITransferN(int fd, struct spi_ioc_transfer* tr, unsigned int n);
 void closeSPIDevice(int fd);
+uint32_t getSPIBufSize(void);
 
 #endif
@@ -130,6 +130,125 @@
 #define U8G2_WITH_FONT_ROTATION
 #endif
 
+/*
+  Enable dirty tile tracking (libu8g2arm):
+    void u8g2_SetDirtyTileBuffer(u8g2_t *u8g2, uint8_t *buf)
+    void u8g2_SendDirty(u8g2_t *u8g2)
+  Tracking is off until a buffer of u8g2_GetDirtyTileBufferSize(u8g2) bytes
+  is assigned. Each bit of the buffer marks an 8x8 tile that was changed by
+  the draw procedures or u8g2_ClearBuffer(), and u8g2_SendDirty() will only
+  send the changed tiles.
+*/
+#ifndef U8G2_WITHOUT_DIRTY_TILES
+#define U8G2_WITH_DIRTY_TILES
+#endif
+
+/*
+  Enable the shadow buffer (libu8g2arm):
+    void u8g2_SetShadowBuffer(u8g2_t *u8g2, uint8_t *buf)
+    void u8g2_SendDiff(u8g2_t *u8g2)
+  The shadow buffer of u8g2_GetShadowBufferSize(u8g2) bytes holds a copy of
+  the buffer as it was last sent by u8g2_SendDiff(), which will only send
+  the tiles that differ from this copy.
+*/
+#ifndef U8G2_WITHOUT_SHADOW_BUFFER
+#define U8G2_WITH_SHADOW_BUFFER
+#endif
+
+/*
+  Enable sprites (libu8g2arm):
+    uint8_t u8g2_InitSprite(u8g2_t *u8g2, u8g2_sprite_t *sprite, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, uint8_t *data)
+    void u8g2_DrawSprite(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const u8g2_sprite_t *sprite)
+    void u8g2_SetSpriteCache(u8g2_t *u8g2, u8g2_sprite_cache_t *cache)
+  A sprite holds an XBM bitmap converted into the buffer layout for the
+  current rotation. The sprite cache, once assigned, makes u8g2_DrawXBM()
+  convert each bitmap into a sprite on its first draw.
+*/
+#ifndef U8G2_WITHOUT_SPRITES
+#define U8G2_WITH_SPRITES
+#endif
+
+/*
+  Enable the font index (libu8g2arm):
+    void u8g2_InitFontIndexCache(u8g2_font_index_cache_t *cache, u8g2_font_index_t *indexes, uint16_t cnt, uint32_t *data, uint32_t slot_size)
+    void u8g2_SetFontIndexCache(u8g2_t *u8g2, u8g2_font_index_cache_t *cache)
+  Once the cache is assigned, u8g2_SetFont() indexes the glyphs of the
+  font, or reuses the index of a recently used font, and the glyphs are
+  found without searching the glyph list of the font.
+*/
+#ifndef U8G2_WITHOUT_FONT_INDEX
+#define U8G2_WITH_FONT_INDEX
+#endif
+
+/*
+  Enable the glyph cache (libu8g2arm), requires sprites:
+    void u8g2_InitGlyphCache(u8g2_glyph_cache_t *cache, u8g2_glyph_cache_entry_t *entries, uint16_t cnt, uint8_t *data, uint32_t slot_size)
+    void u8g2_SetGlyphCache(u8g2_t *u8g2, u8g2_glyph_cache_t *cache)
+  Once the cache is assigned, the glyphs drawn by u8g2_DrawGlyph() and the
+  string procedures are decoded once into a sprite, which is drawn
+  instead of decoding the glyph again.
+*/
+#ifndef U8G2_WITHOUT_GLYPH_CACHE
+#ifdef U8G2_WITH_SPRITES
+#define U8G2_WITH_GLYPH_CACHE
+#endif
+#endif
+
+/*
+  Enable text atoms (libu8g2arm), requires sprites:
+    uint8_t u8g2_InitStrAtom(u8g2_t *u8g2, u8g2_text_atom_t *atom, const char *str, uint8_t *data, uint32_t size)
+    uint8_t u8g2_InitUTF8Atom(u8g2_t *u8g2, u8g2_text_atom_t *atom, const char *str, uint8_t *data, uint32_t size)
+    u8g2_uint_t u8g2_DrawTextAtom(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_text_atom_t *atom)
+  A text atom is a string rendered once with the current font, font
+  direction and font mode into a sprite, for labels which do not change.
+*/
+#ifndef U8G2_WITHOUT_TEXT_ATOMS
+#ifdef U8G2_WITH_SPRITES
+#define U8G2_WITH_TEXT_ATOMS
+#endif
+#endif
+
+/*
+  Enable font metrics (libu8g2arm):
+    void u8g2_InitFontMetricsCache(u8g2_font_metrics_cache_t *cache, u8g2_font_metrics_t *tables, uint16_t cnt)
+    void u8g2_SetFontMetricsCache(u8g2_t *u8g2, u8g2_font_metrics_cache_t *cache)
+    void u8g2_InitStrWidthCache(u8g2_str_width_cache_t *cache, u8g2_str_width_entry_t *entries, uint16_t cnt, char *data, uint16_t slot_size)
+    void u8g2_SetStrWidthCache(u8g2_t *u8g2, u8g2_str_width_cache_t *cache)
+  With a font metrics cache, u8g2_GetGlyphWidth() takes the width, x
+  offset and delta x of the glyphs 0 to 255 from a table of the font,
+  which is filled as the glyphs are used. With a string width cache,
+  u8g2_GetStrWidth() and u8g2_GetUTF8Width() return the width of
+  recently measured strings without measuring them again.
+*/
+#ifndef U8G2_WITHOUT_FONT_METRICS
+#define U8G2_WITH_FONT_METRICS
+#endif
+
+/*
+  Enable the reentrant polygon fill (libu8g2arm):
+    void u8g2_InitPolygon(u8g2_polygon_t *pg, u8g2_polygon_vertex_t *vertices, uint16_t size)
+    void u8g2_FillPolygon(u8g2_t *u8g2, u8g2_polygon_t *pg)
+    void u8g2_SetPolygon(u8g2_t *u8g2, u8g2_polygon_t *pg)
+  A polygon with vertex memory provided by the caller, filled with the
+  even-odd or the non-zero rule. Once assigned, u8g2_AddPolygonXY() and
+  u8g2_DrawPolygon() use it instead of the global polygon.
+*/
+#ifndef U8G2_WITHOUT_POLYGON_FILL
+#define U8G2_WITH_POLYGON_FILL
+#endif
+
+/*
+  Enable the word at a time font decoder (libu8g2arm): u8g2_font_decode_glyph()
+  reads the run lengths of a glyph from a 32 or 64 bit buffer, which is
+  refilled with unaligned word loads, rather than a byte at a time. The
+  glyphs are drawn the same. Not used for fonts in program memory.
+*/
+#ifndef U8G2_WITHOUT_FAST_FONT_DECODE
+#if !defined(__AVR__) && !defined(ESP8266)
+#define U8G2_WITH_FAST_FONT_DECODE
+#endif
+#endif
+
 /*
   U8glib V2 contains support for unicode plane 0 (Basic Multilingual Plane, BMP).
   The following macro activates this support. Deactivation would save some ROM.
@@ -223,10 +342,19 @@ typedef void (*u8g2_update_dimension_cb)(u8g2_t *u8g2);
 typedef void (*u8g2_update_page_win_cb)(u8g2_t *u8g2);
 typedef void (*u8g2_draw_l90_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
 typedef void (*u8g2_draw_ll_hvline_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+typedef void (*u8g2_draw_box_l90_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+typedef void (*u8g2_draw_ll_box_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+typedef struct u8g2_blit_struct u8g2_blit_t;
+typedef void (*u8g2_draw_blit_l90_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit);
+typedef void (*u8g2_draw_ll_blit_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit);
 
 typedef uint8_t (*u8g2_get_kerning_cb)(u8g2_t *u8g2, uint16_t e1, uint16_t e2);
 
 
+/* size of the font data structure, there is no struct or class... */
+/* this is the size for the new font format */
+#define U8G2_FONT_DATA_STRUCT_SIZE 23
+
 /* from ucglib... */
 struct _u8g2_font_info_t
 {
@@ -300,12 +428,293 @@ struct _u8g2_kerning_t
 };
 typedef struct _u8g2_kerning_t u8g2_kerning_t;
 
+/* header of a glyph, see u8g2_font_read_glyph_header() */
+typedef struct u8g2_glyph_header_struct u8g2_glyph_header_t;
+struct u8g2_glyph_header_struct
+{
+  uint8_t w;			/* size of the glyph bitmap */
+  uint8_t h;
+  int8_t x;			/* offset of the bitmap from the glyph position */
+  int8_t y;
+  int8_t d;			/* delta x, the advance to the next glyph */
+};
+
+
+/*
+  A bitmap drawn into a box. The bitmap pixel at sx,sy is drawn at the
+  upper left corner of the box, and the other pixels of the box are taken
+  from the bitmap by stepping dx_x,dy_x for each pixel to the right and
+  dx_y,dy_y for each pixel down (the rotation callbacks change the steps).
+  Set bitmap pixels are drawn with the draw color, and the other pixels
+  with the inverse color unless bitmap_transparency is set.
+*/
+struct u8g2_blit_struct
+{
+  const uint8_t *bitmap;	/* first byte of the bitmap */
+  u8g2_uint_t stride;		/* bytes per line of the bitmap */
+  uint8_t is_msb_first;		/* 0: XBM, left pixel in bit 0, 1: u8g2_DrawBitmap(), left pixel in bit 7 */
+  u8g2_uint_t sx;
+  u8g2_uint_t sy;
+  int8_t dx_x;
+  int8_t dy_x;
+  int8_t dx_y;
+  int8_t dy_y;
+};
+
+#ifdef U8G2_WITH_SPRITES
+/*
+  An XBM bitmap converted into the buffer layout for a rotation, with 8
+  copies (phases) shifted by 0 to 7 pixels down (vertical_top_lsb) or
+  right (horizontal_right_lsb), one for each pixel position within a
+  buffer byte.
+*/
+typedef struct u8g2_sprite_struct u8g2_sprite_t;
+struct u8g2_sprite_struct
+{
+  const uint8_t *bitmap;	/* the XBM bitmap */
+  u8g2_uint_t w;		/* size of the bitmap */
+  u8g2_uint_t h;
+  uint8_t *data;		/* the phases, NULL if the sprite is drawn from the bitmap */
+  const u8g2_cb_t *cb;		/* rotation of data */
+  u8g2_draw_ll_hvline_cb ll_hvline;	/* buffer layout of data */
+  u8g2_uint_t buf_w;		/* size of the sprite in the buffer (after rotation) */
+  u8g2_uint_t buf_h;
+  u8g2_uint_t phase_stride;	/* bytes per page (vertical_top_lsb) or line (horizontal_right_lsb) of a phase */
+  uint32_t phase_size;		/* bytes per phase */
+  uint32_t last_use;		/* sprite cache clock at the last draw */
+};
+
+/*
+  Least recently used cache of sprites, keyed by bitmap pointer. Each of
+  the cnt sprites has a slot of slot_size bytes for its data.
+*/
+typedef struct u8g2_sprite_cache_struct u8g2_sprite_cache_t;
+struct u8g2_sprite_cache_struct
+{
+  u8g2_sprite_t *sprites;	/* cnt sprites */
+  uint8_t *data;		/* cnt slots of slot_size bytes */
+  uint16_t cnt;
+  uint32_t slot_size;
+  uint32_t clock;		/* incremented for each cached draw */
+  uint32_t hits;		/* draws of a bitmap found in the cache */
+  uint32_t misses;		/* draws that converted the bitmap, or that did not fit a slot */
+};
+#endif /* U8G2_WITH_SPRITES */
+
+#ifdef U8G2_WITH_FONT_INDEX
+/*
+  Offsets from the start of a font to the glyph data of each glyph, for
+  u8g2_font_get_glyph_data(). The glyphs above 255 are kept in the order
+  of the font, which is sorted by encoding, and block[n] is the first of
+  them with an encoding of n*256 or more.
+*/
+typedef struct u8g2_font_index_struct u8g2_font_index_t;
+struct u8g2_font_index_struct
+{
+  const uint8_t *font;		/* indexed font, NULL for a free index */
+  uint32_t *unicode;		/* unicode_size offsets of the glyphs above 255 */
+  uint32_t unicode_size;
+  uint32_t unicode_cnt;		/* glyphs above 255, the unicode offsets are not used if more than unicode_size */
+  uint32_t last_use;		/* font index cache clock at the last u8g2_SetFont() */
+  uint32_t ascii[256];		/* offset of glyph 0 to 255, 0 if not in the font */
+  uint32_t block[257];
+};
+
+/*
+  Least recently used cache of font indexes, keyed by font pointer. Each
+  of the cnt indexes has a slot of slot_size unicode offsets, see
+  u8g2_GetFontIndexSize().
+*/
+typedef struct u8g2_font_index_cache_struct u8g2_font_index_cache_t;
+struct u8g2_font_index_cache_struct
+{
+  u8g2_font_index_t *indexes;	/* cnt indexes */
+  uint32_t *data;		/* cnt slots of slot_size offsets */
+  uint16_t cnt;
+  uint32_t slot_size;
+  uint32_t clock;		/* incremented for each u8g2_SetFont() */
+  uint32_t hits;		/* fonts found in the cache */
+  uint32_t misses;		/* fonts which were indexed */
+};
+#endif /* U8G2_WITH_FONT_INDEX */
+
+#ifdef U8G2_WITH_GLYPH_CACHE
+/*
+  A decoded glyph: the XBM bitmap of the glyph, rotated for the font
+  direction, and its sprite, both in a slot of the glyph cache.
+*/
+typedef struct u8g2_glyph_cache_entry_struct u8g2_glyph_cache_entry_t;
+struct u8g2_glyph_cache_entry_struct
+{
+  const uint8_t *font;		/* NULL for a free entry */
+  uint16_t encoding;
+  uint8_t dir;			/* font direction */
+  int8_t delta_x;		/* returned by u8g2_DrawGlyph() */
+  u8g2_uint_t off_x;		/* upper left corner of the bitmap, relative to the glyph position */
+  u8g2_uint_t off_y;
+  uint32_t last_use;		/* glyph cache clock at the last draw */
+  u8g2_sprite_t sprite;
+};
+
+/*
+  Cache of decoded glyphs, keyed by font, encoding and direction. Each of
+  the cnt entries has a slot of slot_size bytes for its bitmap and
+  sprite. The entries are grouped into sets of U8G2_GLYPH_CACHE_WAYS,
+  and a glyph replaces the least recently used entry of its set.
+*/
+#define U8G2_GLYPH_CACHE_WAYS 4
+typedef struct u8g2_glyph_cache_struct u8g2_glyph_cache_t;
+struct u8g2_glyph_cache_struct
+{
+  u8g2_glyph_cache_entry_t *entries;	/* cnt entries */
+  uint8_t *data;		/* cnt slots of slot_size bytes */
+  uint16_t cnt;
+  uint16_t sets;		/* number of sets of entries */
+  uint32_t slot_size;
+  uint32_t clock;		/* incremented for each cached draw */
+  uint32_t hits;		/* glyphs found in the cache */
+  uint32_t misses;		/* glyphs which were decoded */
+};
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
+#ifdef U8G2_WITH_TEXT_ATOMS
+/*
+  A string rendered into the XBM bitmap of its bounding box, and the
+  sprite of the bitmap, both in the data of the atom. The string metrics
+  are kept, so that the string is not decoded again.
+*/
+typedef struct u8g2_text_atom_struct u8g2_text_atom_t;
+struct u8g2_text_atom_struct
+{
+  uint8_t *data;		/* bitmap and sprite data, size bytes */
+  uint32_t size;
+  u8g2_uint_t off_x;		/* upper left corner of the bitmap, relative to the string position */
+  u8g2_uint_t off_y;
+  u8g2_uint_t width;		/* u8g2_GetStrWidth() or u8g2_GetUTF8Width() of the string */
+  u8g2_uint_t delta;		/* returned by u8g2_DrawStr() or u8g2_DrawUTF8() */
+  uint8_t is_transparent;	/* font mode */
+  u8g2_sprite_t sprite;		/* w or h is 0 if the string has no pixels */
+};
+#endif /* U8G2_WITH_TEXT_ATOMS */
+
+#ifdef U8G2_WITH_FONT_METRICS
+/* metrics of a glyph, as set by u8g2_GetGlyphWidth() */
+#define U8G2_GLYPH_METRICS_UNKNOWN 0
+#define U8G2_GLYPH_METRICS_GLYPH 1
+#define U8G2_GLYPH_METRICS_NO_GLYPH 2
+typedef struct u8g2_glyph_metrics_struct u8g2_glyph_metrics_t;
+struct u8g2_glyph_metrics_struct
+{
+  uint8_t w;			/* size of the glyph bitmap */
+  uint8_t h;
+  int8_t x;			/* x offset of the bitmap */
+  int8_t d;			/* delta x */
+  uint8_t state;		/* U8G2_GLYPH_METRICS_UNKNOWN until the glyph is used */
+};
+
+/* Metrics of the glyphs 0 to 255 of a font */
+typedef struct u8g2_font_metrics_struct u8g2_font_metrics_t;
+struct u8g2_font_metrics_struct
+{
+  const uint8_t *font;		/* NULL for a free table */
+  uint32_t last_use;		/* font metrics cache clock when the table was selected */
+  u8g2_glyph_metrics_t glyphs[256];
+};
+
+/* Least recently used cache of font metrics tables, keyed by font pointer */
+typedef struct u8g2_font_metrics_cache_struct u8g2_font_metrics_cache_t;
+struct u8g2_font_metrics_cache_struct
+{
+  u8g2_font_metrics_t *tables;	/* cnt tables */
+  uint16_t cnt;
+  uint32_t clock;		/* incremented for each selected table */
+  uint32_t hits;		/* glyphs found in the table */
+  uint32_t misses;		/* glyphs which were read from the font */
+};
+
+/*
+  A measured string: the string is kept in the slot of the entry, with
+  the width and the values which u8g2_GetStrWidth() leaves in
+  font_decode.glyph_width and glyph_x_offset.
+*/
+typedef struct u8g2_str_width_entry_struct u8g2_str_width_entry_t;
+struct u8g2_str_width_entry_struct
+{
+  const uint8_t *font;		/* NULL for a free entry */
+  u8x8_char_cb next_cb;		/* u8x8_ascii_next or u8x8_utf8_next */
+  uint32_t hash;		/* of the string */
+  uint16_t len;			/* strlen() of the string */
+  u8g2_uint_t width;
+  int8_t glyph_width;
+  int8_t glyph_x_offset;
+  uint32_t last_use;		/* string width cache clock at the last use */
+};
+
+/*
+  Cache of measured strings, keyed by font, string and char procedure.
+  Each of the cnt entries has a slot of slot_size chars for its string,
+  longer strings are measured each time. The entries are grouped into
+  sets of U8G2_STR_WIDTH_CACHE_WAYS, and a string replaces the least
+  recently used entry of its set.
+*/
+#define U8G2_STR_WIDTH_CACHE_WAYS 4
+typedef struct u8g2_str_width_cache_struct u8g2_str_width_cache_t;
+struct u8g2_str_width_cache_struct
+{
+  u8g2_str_width_entry_t *entries;	/* cnt entries */
+  char *data;			/* cnt slots of slot_size chars */
+  uint16_t cnt;
+  uint16_t sets;		/* number of sets of entries */
+  uint16_t slot_size;
+  uint32_t clock;		/* incremented for each measured string */
+  uint32_t hits;		/* strings found in the cache */
+  uint32_t misses;		/* strings which were measured */
+};
+#endif /* U8G2_WITH_FONT_METRICS */
+
+#ifdef U8G2_WITH_POLYGON_FILL
+/*
+  Polygon with vertex memory provided by the caller, see u8g2_InitPolygon().
+  Besides the point, each vertex holds the scan state of the edge to the
+  next vertex while the polygon is filled.
+*/
+#define U8G2_POLYGON_EVEN_ODD 0
+#define U8G2_POLYGON_NON_ZERO 1
+
+typedef struct u8g2_polygon_vertex_struct u8g2_polygon_vertex_t;
+struct u8g2_polygon_vertex_struct
+{
+  int16_t x;
+  int16_t y;
+  /* edge to the next vertex, used by u8g2_FillPolygon() */
+  int32_t cur_x;	/* first pixel right of the edge in the current row */
+  int32_t err;		/* cur_x*den minus the exact position, 0 <= err < den */
+  int32_t step;		/* cur_x step for each row */
+  int32_t rem;		/* err step for each row */
+  int32_t den;
+  int32_t y0;		/* first row */
+  int32_t y1;		/* last row + 1 */
+  int8_t dir;		/* 1: downwards, -1: upwards */
+  uint16_t next;	/* next edge in the edge table or active edge list */
+};
+
+typedef struct u8g2_polygon_struct u8g2_polygon_t;
+struct u8g2_polygon_struct
+{
+  u8g2_polygon_vertex_t *vertices;	/* size vertices */
+  uint16_t size;
+  uint16_t cnt;
+  uint8_t fill_rule;	/* U8G2_POLYGON_EVEN_ODD or U8G2_POLYGON_NON_ZERO */
+};
+#endif /* U8G2_WITH_POLYGON_FILL */
 
 struct u8g2_cb_struct
 {
   u8g2_update_dimension_cb update_dimension;
   u8g2_update_page_win_cb update_page_win;
   u8g2_draw_l90_cb draw_l90;
+  u8g2_draw_box_l90_cb draw_box_l90;	/* may be NULL, then boxes are drawn with draw_l90 */
+  u8g2_draw_blit_l90_cb draw_blit_l90;	/* may be NULL, then bitmaps are drawn with draw_l90 */
 };
 
 typedef u8g2_uint_t (*u8g2_font_calc_vref_fnptr)(u8g2_t *u8g2);
@@ -315,6 +724,8 @@ struct u8g2_struct
 {
   u8x8_t u8x8;
   u8g2_draw_ll_hvline_cb ll_hvline;	/* low level hvline procedure */
+  u8g2_draw_ll_box_cb ll_box;		/* low level box procedure, assigned by u8g2_SetupBuffer() */
+  u8g2_draw_ll_blit_cb ll_blit;		/* low level bitmap procedure, assigned by u8g2_SetupBuffer() */
   const u8g2_cb_t *cb;		/* callback drawprocedures, can be replaced for rotation */
   
   /* the following variables must be assigned during u8g2 setup */
@@ -322,6 +733,38 @@ struct u8g2_struct
   uint8_t tile_buf_height;	/* height of the tile memory area in tile rows */
   uint8_t tile_curr_row;	/* current row for picture loop */
   
+#ifdef U8G2_WITH_DIRTY_TILES
+  uint8_t *dirty_tile_ptr;	/* one bit per tile of the buffer, NULL if tracking is off */
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  uint8_t *shadow_buf_ptr;	/* copy of the buffer last sent by u8g2_SendDiff(), NULL if not used */
+  uint8_t is_shadow_valid;	/* 0 until the shadow buffer holds a sent frame */
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+
+#ifdef U8G2_WITH_SPRITES
+  u8g2_sprite_cache_t *sprite_cache;	/* used by u8g2_DrawXBM(), NULL if not used */
+#endif /* U8G2_WITH_SPRITES */
+
+#ifdef U8G2_WITH_POLYGON_FILL
+  u8g2_polygon_t *polygon;	/* used by u8g2_AddPolygonXY() and u8g2_DrawPolygon(), NULL for the global polygon */
+#endif /* U8G2_WITH_POLYGON_FILL */
+
+#ifdef U8G2_WITH_FONT_INDEX
+  u8g2_font_index_cache_t *font_index_cache;	/* used by u8g2_SetFont(), NULL if not used */
+  u8g2_font_index_t *font_index;	/* index of the current font, only used if font_index->font == font */
+#endif /* U8G2_WITH_FONT_INDEX */
+
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2_glyph_cache_t *glyph_cache;	/* used by u8g2_DrawGlyph(), NULL if not used */
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
+#ifdef U8G2_WITH_FONT_METRICS
+  u8g2_font_metrics_cache_t *font_metrics_cache;	/* used by u8g2_GetGlyphWidth(), NULL if not used */
+  u8g2_font_metrics_t *font_metrics;	/* table of the current font, only used if font_metrics->font == font */
+  u8g2_str_width_cache_t *str_width_cache;	/* used by u8g2_GetStrWidth() and u8g2_GetUTF8Width(), NULL if not used */
+#endif /* U8G2_WITH_FONT_METRICS */
+
   /* dimension of the buffer in pixel */
   u8g2_uint_t pixel_buf_width;		/* equal to tile_buf_width*8 */
   u8g2_uint_t pixel_buf_height;		/* tile_buf_height*8 */
@@ -430,6 +873,8 @@ void u8g2_ClearDisplay(u8g2_t *u8g2);
 /* u8g2_setup.c */
 
 void u8g2_draw_l90_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_draw_box_l90_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_draw_blit_l90_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit);
 
 extern const u8g2_cb_t u8g2_cb_r0;
 extern const u8g2_cb_t u8g2_cb_r1;
@@ -1392,6 +1837,22 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2);
 void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th);
 void u8g2_UpdateDisplay(u8g2_t *u8g2);
 
+#ifdef U8G2_WITH_DIRTY_TILES
+/* bytes per tile row in the dirty tile buffer, and size of the buffer */
+#define u8g2_GetDirtyTileRowSize(u8g2) ((u8g2_GetU8x8(u8g2)->display_info->tile_width + 7) >> 3)
+#define u8g2_GetDirtyTileBufferSize(u8g2) (u8g2_GetDirtyTileRowSize(u8g2) * (u8g2)->tile_buf_height)
+void u8g2_SetDirtyTileBuffer(u8g2_t *u8g2, uint8_t *buf);
+void u8g2_MarkDirtyArea(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+void u8g2_mark_dirty_tiles(u8g2_t *u8g2, uint8_t tx0, uint8_t ty0, uint8_t tx1, uint8_t ty1);
+void u8g2_SendDirty(u8g2_t *u8g2);
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+#ifdef U8G2_WITH_SHADOW_BUFFER
+#define u8g2_GetShadowBufferSize(u8g2) (u8g2_GetU8x8(u8g2)->display_info->tile_width * 8 * (u8g2)->tile_buf_height)
+void u8g2_SetShadowBuffer(u8g2_t *u8g2, uint8_t *buf);
+void u8g2_SendDiff(u8g2_t *u8g2);
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+
 void u8g2_WriteBufferPBM(u8g2_t *u8g2, void (*out)(const char *s));
 void u8g2_WriteBufferXBM(u8g2_t *u8g2, void (*out)(const char *s));
 /* SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0 */ 
@@ -1415,12 +1876,49 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 /* ST7920 */
 void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
 
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box in pixel, w and h must not be 0
+  asumption: 
+    all clipping done
+  u8g2_SetupBuffer() assigns the box procedure of the ll_hvline_cb buffer
+  layout, or u8g2_ll_box_hvline for any other ll_hvline_cb.
+*/
+
+/* SSD13xx, UC17xx, UC16xx */
+void u8g2_ll_box_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+/* ST7920 */
+void u8g2_ll_box_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+/* any buffer, one u8g2->ll_hvline call per line */
+void u8g2_ll_box_hvline(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box in pixel, w and h must not be 0
+  blit		the bitmap, with sx,sy and the steps in buffer directions
+  asumption: 
+    all clipping done
+*/
+
+/* SSD13xx, UC17xx, UC16xx */
+void u8g2_ll_blit_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit);
+/* ST7920 */
+void u8g2_ll_blit_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit);
+/* any buffer, one u8g2->ll_hvline call per pixel */
+void u8g2_ll_blit_hvline(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit);
+/* 1 if the bitmap pixel sx,sy is set */
+uint8_t u8g2_blit_pixel(const u8g2_blit_t *blit, u8g2_uint_t sx, u8g2_uint_t sy);
+
 
 /*==========================================*/
 /* u8g2_hvline.c */
 
 /* u8g2_DrawHVLine does not use u8g2_IsIntersection */
 void u8g2_DrawHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+/* clip and rotate a box once, and draw it with u8g2->ll_box */
+void u8g2_DrawHVBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+/* clip and rotate a bitmap box once, and draw it with u8g2->ll_blit, blit->sx,sy is the bitmap pixel at x,y */
+void u8g2_DrawHVBlit(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const u8g2_blit_t *blit);
 
 /* the following three function will do an intersection test of this is enabled with U8G2_WITH_INTERSECTION */
 void u8g2_DrawHLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len);
@@ -1436,6 +1934,66 @@ void u8g2_DrawHorizontalBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_
 void u8g2_DrawBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt, u8g2_uint_t h, const uint8_t *bitmap);
 void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
 void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);	/* assumes bitmap in PROGMEM */
+void u8g2_draw_bitmap_box(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, u8g2_uint_t stride, uint8_t is_msb_first, const uint8_t *bitmap);
+
+/*==========================================*/
+/* u8g2_sprite.c */
+#ifdef U8G2_WITH_SPRITES
+uint32_t u8g2_GetSpriteDataSize(u8g2_t *u8g2, u8g2_uint_t w, u8g2_uint_t h);
+uint8_t u8g2_InitSprite(u8g2_t *u8g2, u8g2_sprite_t *sprite, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, uint8_t *data);
+void u8g2_DrawSprite(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const u8g2_sprite_t *sprite);
+void u8g2_InitSpriteCache(u8g2_sprite_cache_t *cache, u8g2_sprite_t *sprites, uint16_t cnt, uint8_t *data, uint32_t slot_size);
+void u8g2_SetSpriteCache(u8g2_t *u8g2, u8g2_sprite_cache_t *cache);
+void u8g2_ClearSpriteCache(u8g2_sprite_cache_t *cache);
+void u8g2_draw_cached_sprite(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+#endif /* U8G2_WITH_SPRITES */
+
+/*==========================================*/
+/* u8g2_font_index.c */
+#ifdef U8G2_WITH_FONT_INDEX
+uint32_t u8g2_GetFontIndexSize(const uint8_t *font);
+void u8g2_InitFontIndexCache(u8g2_font_index_cache_t *cache, u8g2_font_index_t *indexes, uint16_t cnt, uint32_t *data, uint32_t slot_size);
+void u8g2_SetFontIndexCache(u8g2_t *u8g2, u8g2_font_index_cache_t *cache);
+void u8g2_ClearFontIndexCache(u8g2_font_index_cache_t *cache);
+void u8g2_select_font_index(u8g2_t *u8g2);
+uint8_t u8g2_font_index_get_glyph_data(const u8g2_font_index_t *index, uint16_t encoding, const uint8_t **glyph_data);
+#endif /* U8G2_WITH_FONT_INDEX */
+
+/*==========================================*/
+/* u8g2_glyph_cache.c */
+#ifdef U8G2_WITH_GLYPH_CACHE
+uint32_t u8g2_GetGlyphCacheSlotSize(u8g2_t *u8g2);
+void u8g2_InitGlyphCache(u8g2_glyph_cache_t *cache, u8g2_glyph_cache_entry_t *entries, uint16_t cnt, uint8_t *data, uint32_t slot_size);
+void u8g2_SetGlyphCache(u8g2_t *u8g2, u8g2_glyph_cache_t *cache);
+void u8g2_ClearGlyphCache(u8g2_glyph_cache_t *cache);
+u8g2_uint_t u8g2_draw_cached_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding);
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
+/*==========================================*/
+/* u8g2_text_atom.c */
+#ifdef U8G2_WITH_TEXT_ATOMS
+uint32_t u8g2_GetStrAtomDataSize(u8g2_t *u8g2, const char *str);
+uint32_t u8g2_GetUTF8AtomDataSize(u8g2_t *u8g2, const char *str);
+uint8_t u8g2_InitStrAtom(u8g2_t *u8g2, u8g2_text_atom_t *atom, const char *str, uint8_t *data, uint32_t size);
+uint8_t u8g2_InitUTF8Atom(u8g2_t *u8g2, u8g2_text_atom_t *atom, const char *str, uint8_t *data, uint32_t size);
+u8g2_uint_t u8g2_DrawTextAtom(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_text_atom_t *atom);
+#define u8g2_GetTextAtomWidth(atom) ((atom)->width)
+#define u8g2_GetTextAtomBoxWidth(atom) ((atom)->sprite.w)
+#define u8g2_GetTextAtomBoxHeight(atom) ((atom)->sprite.h)
+#endif /* U8G2_WITH_TEXT_ATOMS */
+
+/*==========================================*/
+/* u8g2_font_metrics.c */
+#ifdef U8G2_WITH_FONT_METRICS
+void u8g2_InitFontMetricsCache(u8g2_font_metrics_cache_t *cache, u8g2_font_metrics_t *tables, uint16_t cnt);
+void u8g2_SetFontMetricsCache(u8g2_t *u8g2, u8g2_font_metrics_cache_t *cache);
+void u8g2_ClearFontMetricsCache(u8g2_font_metrics_cache_t *cache);
+const u8g2_glyph_metrics_t *u8g2_font_get_glyph_metrics(u8g2_t *u8g2, uint16_t encoding);
+void u8g2_InitStrWidthCache(u8g2_str_width_cache_t *cache, u8g2_str_width_entry_t *entries, uint16_t cnt, char *data, uint16_t slot_size);
+void u8g2_SetStrWidthCache(u8g2_t *u8g2, u8g2_str_width_cache_t *cache);
+void u8g2_ClearStrWidthCache(u8g2_str_width_cache_t *cache);
+u8g2_uint_t u8g2_get_cached_str_width(u8g2_t *u8g2, const char *str);
+#endif /* U8G2_WITH_FONT_METRICS */
 
 
 /*==========================================*/
@@ -1461,6 +2019,13 @@ void u8g2_DrawFilledEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_u
 /*==========================================*/
 /* u8g2_line.c */
 void u8g2_DrawLine(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2);
+void u8g2_DrawThickLine(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t w);
+void u8g2_limit_span(u8g2_long_t alpha, u8g2_long_t beta, u8g2_long_t *lo, u8g2_long_t *hi);
+
+/*==========================================*/
+/* u8g2_arc.c */
+void u8g2_DrawArc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t start, uint8_t end);
+void u8g2_DrawFilledArc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, u8g2_uint_t rad_in, uint8_t start, uint8_t end);
 
 
 /*==========================================*/
@@ -1507,6 +2072,14 @@ void u8g2_ClearPolygonXY(void);
 void u8g2_AddPolygonXY(u8g2_t *u8g2, int16_t x, int16_t y);
 void u8g2_DrawPolygon(u8g2_t *u8g2);
 void u8g2_DrawTriangle(u8g2_t *u8g2, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+#ifdef U8G2_WITH_POLYGON_FILL
+void u8g2_InitPolygon(u8g2_polygon_t *pg, u8g2_polygon_vertex_t *vertices, uint16_t size);
+void u8g2_ClearPolygon(u8g2_polygon_t *pg);
+void u8g2_SetPolygonFillRule(u8g2_polygon_t *pg, uint8_t fill_rule);
+uint8_t u8g2_AddPolygonVertex(u8g2_polygon_t *pg, int16_t x, int16_t y);
+void u8g2_SetPolygon(u8g2_t *u8g2, u8g2_polygon_t *pg);
+void u8g2_FillPolygon(u8g2_t *u8g2, u8g2_polygon_t *pg);
+#endif /* U8G2_WITH_POLYGON_FILL */
 
 
 
@@ -1525,6 +2098,16 @@ u8g2_uint_t u8g2_add_vector_x(u8g2_uint_t dx, int8_t x, int8_t y, uint8_t dir) U
 
 
 size_t u8g2_GetFontSize(const uint8_t *font_arg);
+const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding);
+uint8_t u8g2_font_decode_get_unsigned_bits(u8g2_font_decode_t *f, uint8_t cnt);
+int8_t u8g2_font_decode_get_signed_bits(u8g2_font_decode_t *f, uint8_t cnt);
+int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data);
+void u8g2_font_read_glyph_header(u8g2_t *u8g2, u8g2_font_decode_t *decode, const uint8_t *glyph_data, u8g2_glyph_header_t *header);
+u8g2_uint_t u8g2_font_calc_str_width(u8g2_t *u8g2, const char *str);
+#ifdef U8G2_WITH_SPRITES
+void u8g2_font_get_glyph_box(const u8g2_glyph_header_t *header, uint8_t dir, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t *bx, u8g2_uint_t *by, u8g2_uint_t *bw, u8g2_uint_t *bh);
+void u8g2_font_decode_glyph_xbm(u8g2_t *u8g2, u8g2_font_decode_t *decode, const u8g2_glyph_header_t *header, uint8_t *bitmap, u8g2_uint_t stride, u8g2_uint_t bx, u8g2_uint_t by, uint8_t dir);
+#endif /* U8G2_WITH_SPRITES */
 
 #define U8G2_FONT_HEIGHT_MODE_TEXT 0
 #define U8G2_FONT_HEIGHT_MODE_XTEXT 1
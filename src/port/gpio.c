@@ -29,13 +29,19 @@
 #define GPIO_FILENAME_DEFINE(pin,field) char fileName[255] = {0}; \
         sprintf(fileName, "/sys/class/gpio/gpio%d/%s", pin, field);
 
+struct gpio_chip_t {
+    FILE* fp_value[GPIO_PIN_CNT];   // open value files, indexed by pin
+};
+
+static gpio_chip_t default_chip;
+
 static int writeValueToFile(char* fileName, char* buff)
 {
     FILE *fp = fopen(fileName, "w");
     if (fp != NULL)
     {
         fwrite(buff, strlen(buff), 1, fp);
-        fflush(fp);
+        fclose(fp);
         return 0;
     }
     return -1;
@@ -113,28 +119,48 @@ int getGPIOValue(int pin)
 
 int setGPIOValue(int pin, int value)
 {
-    static FILE* fp_gpio[255];
-    if(fp_gpio[pin] != NULL)
+    return setGPIOChipValue(NULL, pin, value);
+}
+
+gpio_chip_t *openGPIOChip(const char *chip_path)
+{
+    (void) chip_path; /* not used with sysfs */
+    return calloc(1, sizeof(gpio_chip_t));
+}
+
+void closeGPIOChip(gpio_chip_t *chip)
+{
+    int pin;
+    if (chip == NULL)
+        return;
+    for (pin = 0; pin < GPIO_PIN_CNT; pin++)
     {
-        fprintf(fp_gpio[pin], "%d", value);
-        fflush(fp_gpio[pin]);
-        return 0;
+        if (chip->fp_value[pin] != NULL)
+            fclose(chip->fp_value[pin]);
     }
-    else
+    if (chip != &default_chip)
+        free(chip);
+}
+
+int setGPIOChipValue(gpio_chip_t *chip, int pin, int value)
+{
+    FILE** fp_gpio = (chip ? chip : &default_chip)->fp_value;
+    if (pin < 0 || pin >= GPIO_PIN_CNT)
+    {
+        return -1;
+    }
+    if(fp_gpio[pin] == NULL)
     {
         GPIO_FILENAME_DEFINE(pin, "value")
         fp_gpio[pin] = fopen(fileName, "w+");
-        if (fp_gpio[pin] != NULL)
-        {
-            fprintf(fp_gpio[pin], "%d", value);
-            fflush(fp_gpio[pin]);
-            return 0;
-        }
-        else
+        if (fp_gpio[pin] == NULL)
         {
             return -1;
         }
     }
+    fprintf(fp_gpio[pin], "%d", value);
+    fflush(fp_gpio[pin]);
+    return 0;
 }
 
 int setGPIODirection(int pin, int direction)
@@ -184,15 +210,83 @@ int getGPIODirection(int pin)
     return ret;
 }
 
+int exportGPIOChipOutputs(gpio_chip_t *chip, const int *pins, int count,
+                          int value)
+{
+    int i;
+    for (i = 0; i < count; i++)
+    {
+        exportGPIOPin(pins[i]);
+        setGPIODirection(pins[i], GPIO_OUT);
+        setGPIOChipValue(chip, pins[i], value);
+    }
+    return 0;
+}
+
+int setGPIOChipValues(gpio_chip_t *chip, const int *pins, const int *values,
+                      int count)
+{
+    int i;
+    for (i = 0; i < count; i++)
+    {
+        setGPIOChipValue(chip, pins[i], values[i]);
+    }
+    return 0;
+}
+
+int exportGPIOOutputs(const int *pins, int count, int value)
+{
+    return exportGPIOChipOutputs(NULL, pins, count, value);
+}
+
+int setGPIOValues(const int *pins, const int *values, int count)
+{
+    return setGPIOChipValues(NULL, pins, values, count);
+}
+
 #else
 
 #include <gpiod.h>
 
-static const char *const chip_path = "/dev/gpiochip0";
-static struct gpiod_chip *chip = NULL;
+struct gpio_chip_t {
+	struct gpiod_chip *chip;
+	struct {
+		struct gpiod_line_request *request;
+		int line_offset;
+		int direction;
+	} ports[GPIO_PIN_CNT];
+};
+
+static gpio_chip_t default_chip = { NULL };
+
+/* Get the chip to use, opening the shared chip on first use. */
+static gpio_chip_t *get_chip(gpio_chip_t *chip)
+{
+	if(NULL != chip)
+		return chip;
+	if(NULL == default_chip.chip)
+	{
+		default_chip.chip = gpiod_chip_open(GPIO_DEFAULT_CHIP);
+		if(NULL == default_chip.chip)
+			perror("gpiod_chip_open(GPIO_DEFAULT_CHIP)");
+	}
+	return &default_chip;
+}
+
+/* Get the line offset for a pin number, or -1 if not found. */
+static int get_line_offset(gpio_chip_t *chip, int pin)
+{
+	char gpioName[8];
+	int line_offset;
+	snprintf(gpioName, sizeof(gpioName), "GPIO%d", pin);
+	line_offset = gpiod_chip_get_line_offset_from_name(chip->chip, gpioName);
+	if(-1 == line_offset)
+		perror("gpiod_chip_get_line_offset_from_name");
+	return line_offset;
+}
 
 /* Request a line as input. */
-static struct gpiod_line_request *request_input_line( unsigned int offset, const char *consumer)
+static struct gpiod_line_request *request_input_line(struct gpiod_chip *chip, unsigned int offset, const char *consumer)
 {
         struct gpiod_request_config *req_cfg = NULL;
         struct gpiod_line_request *request = NULL;
@@ -272,64 +366,96 @@ free_settings:
         return ret;
 }
 
-static struct {
-	struct gpiod_line_request *request;
-	int line_offset;
-	int direction;
-	int value;
-} gpio_ports[256] = { NULL };
+/* Request several lines as outputs in a single request. */
+static struct gpiod_line_request *request_output_lines(struct gpiod_chip *chip,
+                                                       const unsigned int *offsets,
+                                                       int count,
+                                                       enum gpiod_line_value value,
+                                                       const char *consumer)
+{
+        struct gpiod_request_config *req_cfg = NULL;
+        struct gpiod_line_request *request = NULL;
+        struct gpiod_line_settings *settings;
+        struct gpiod_line_config *line_cfg;
+        int ret;
+
+        settings = gpiod_line_settings_new();
+        if (!settings)
+                return NULL;
+
+        gpiod_line_settings_set_direction(settings,
+                                          GPIOD_LINE_DIRECTION_OUTPUT);
+        gpiod_line_settings_set_output_value(settings, value);
+
+        line_cfg = gpiod_line_config_new();
+        if (!line_cfg)
+                goto free_settings;
+
+        ret = gpiod_line_config_add_line_settings(line_cfg, offsets, count,
+                                                  settings);
+        if (ret)
+                goto free_line_config;
+
+        req_cfg = gpiod_request_config_new();
+        if (!req_cfg)
+                goto free_line_config;
+
+        gpiod_request_config_set_consumer(req_cfg, consumer);
+        request = gpiod_chip_request_lines(chip, req_cfg, line_cfg);
+
+        gpiod_request_config_free(req_cfg);
+
+free_line_config:
+        gpiod_line_config_free(line_cfg);
+
+free_settings:
+        gpiod_line_settings_free(settings);
+
+        return request;
+}
 
 int exportGPIOPin(int pin)
 {
-	char gpioName[8];
-	int offset = pin & 0xFF;
-	int line_offset = -1;
-	if(NULL == chip)
-	{
-		chip = gpiod_chip_open(chip_path);
-	}
-	if(NULL != chip)
+	gpio_chip_t *chip = get_chip(NULL);
+	int offset = pin;
+	int line_offset;
+	if(pin < 0 || pin >= GPIO_PIN_CNT)
+		return(-1);
+	if(NULL != chip->chip && NULL == chip->ports[offset].request)
 	{
-		snprintf(gpioName, sizeof(gpioName), "GPIO%d", offset);
-		line_offset = gpiod_chip_get_line_offset_from_name(chip, gpioName);
+		line_offset = get_line_offset(chip, offset);
 		if(-1 != line_offset)
 		{
-			gpio_ports[offset].line_offset = line_offset;
-			gpio_ports[offset].request = request_input_line(offset, gpioName);
+			char gpioName[8];
+			snprintf(gpioName, sizeof(gpioName), "GPIO%d", offset);
+			chip->ports[offset].line_offset = line_offset;
+			chip->ports[offset].direction = GPIO_IN;
+			chip->ports[offset].request = request_input_line(chip->chip, line_offset, gpioName);
 		}
-		else
-		{
-			perror("gpiod_chip_get_line_offset_from_name");
-		}
-	}
-	else
-	{
-		perror("gpiod_chip_open(chip_path)");
 	}
-	// fprintf(stderr, "%s(%i)=>(chip=%p, line_offset=%i, request=%p)" "\n", __func__, pin, chip, line_offset, gpio_ports[offset].request);
+	// fprintf(stderr, "%s(%i)=>(chip=%p, request=%p)" "\n", __func__, pin, chip->chip, chip->ports[offset].request);
 	return(0);
 }
 
 int unexportGPIOPin(int pin)
 {
-	int offset = pin & 0xFF;
-	int line_offset = gpio_ports[offset].line_offset;
-	if(-1 != line_offset)
-	{
-		gpio_ports[offset].line_offset = -1;
-	}
+	// requests are kept until the chip is closed, as a request may hold
+	// several pins
+	(void) pin;
 	// fprintf(stderr, "%s(%i)" "\n", __func__, pin);
 	return(0);
 }
 
 int getGPIOValue(int pin)
 {
+	gpio_chip_t *chip = get_chip(NULL);
 	int value = -1;
-	int offset = pin & 0xFF;
-	int line_offset = gpio_ports[offset].line_offset;
-	if(-1 != line_offset)
+	int offset = pin;
+	if(pin < 0 || pin >= GPIO_PIN_CNT)
+		return(-1);
+	if(NULL != chip->ports[offset].request)
 	{
-		value = gpiod_line_request_get_value(gpio_ports[offset].request, gpio_ports[offset].line_offset);
+		value = gpiod_line_request_get_value(chip->ports[offset].request, chip->ports[offset].line_offset);
 	}
 	// fprintf(stderr, "%s(%i)=>%i" "\n", __func__, pin, value);
 	return(value);
@@ -337,25 +463,19 @@ int getGPIOValue(int pin)
 
 int setGPIOValue(int pin, int value)
 {
-	int actualValue = value;
-	int offset = pin & 0xFF;
-	int line_offset = gpio_ports[offset].line_offset;
-	// fprintf(stderr, "%s(%i, %i)(request=%p, line=%i, actualvalue=%i)" "\n", __func__, pin, value, gpio_ports[offset].request, line_offset, actualValue);
-	if(-1 != line_offset)
-	{
-		gpiod_line_request_set_value(gpio_ports[offset].request, line_offset, value);
-		// perror("gpiod_line_request_set_value()");
-	}
-	return(0);
+	return setGPIOChipValue(NULL, pin, value);
 }
 
 int setGPIODirection(int pin, int direction)
 {
-	int offset = pin & 0xFF;
-	int line_offset = gpio_ports[offset].line_offset;
+	gpio_chip_t *chip = get_chip(NULL);
+	int offset = pin;
+	if(pin < 0 || pin >= GPIO_PIN_CNT)
+		return(-1);
 	// fprintf(stderr, "%s(%i, %i)" "\n", __func__, pin, direction);
-	if(direction){
-		reconfigure_as_output_line(gpio_ports[offset].request, line_offset, 0);
+	if(direction && NULL != chip->ports[offset].request){
+		reconfigure_as_output_line(chip->ports[offset].request, chip->ports[offset].line_offset, 0);
+		chip->ports[offset].direction = GPIO_OUT;
 		// perror("reconfigure_as_output_line");
 	}
 	return(0);
@@ -363,16 +483,181 @@ int setGPIODirection(int pin, int direction)
 
 int getGPIODirection(int pin)
 {
+	gpio_chip_t *chip = get_chip(NULL);
 	int direction = 0;
-	int offset = pin & 0xFF;
-	int line_offset = gpio_ports[offset].line_offset;
-	if(-1 != line_offset)
+	int offset = pin;
+	if(pin < 0 || pin >= GPIO_PIN_CNT)
+		return(-1);
+	if(NULL != chip->ports[offset].request)
 	{
-		direction = gpio_ports[offset].direction;
+		direction = chip->ports[offset].direction;
 	}
 	// fprintf(stderr, "%s(%i)=>%i" "\n", __func__, pin, direction);
 	return(direction);
 }
 
-#endif
+gpio_chip_t *openGPIOChip(const char *chip_path)
+{
+	gpio_chip_t *chip = calloc(1, sizeof(gpio_chip_t));
+	if(NULL == chip)
+		return(NULL);
+	chip->chip = gpiod_chip_open(chip_path ? chip_path : GPIO_DEFAULT_CHIP);
+	if(NULL == chip->chip)
+	{
+		perror("gpiod_chip_open(chip_path)");
+		free(chip);
+		return(NULL);
+	}
+	return(chip);
+}
+
+void closeGPIOChip(gpio_chip_t *chip)
+{
+	struct gpiod_line_request *request;
+	int pin, i;
+	if(NULL == chip)
+		return;
+	// a request may hold several pins, release it once
+	for(pin = 0; pin < GPIO_PIN_CNT; pin++)
+	{
+		request = chip->ports[pin].request;
+		if(NULL == request)
+			continue;
+		for(i = pin; i < GPIO_PIN_CNT; i++)
+		{
+			if(chip->ports[i].request == request)
+				chip->ports[i].request = NULL;
+		}
+		gpiod_line_request_release(request);
+	}
+	if(NULL != chip->chip)
+		gpiod_chip_close(chip->chip);
+	if(chip == &default_chip)
+		chip->chip = NULL;
+	else
+		free(chip);
+}
+
+int exportGPIOChipOutputs(gpio_chip_t *chip, const int *pins, int count,
+                          int value)
+{
+	unsigned int line_offsets[GPIO_MAX_PINS];
+	int new_pins[GPIO_MAX_PINS];
+	struct gpiod_line_request *request;
+	int i, j, line_offset, offset, new_cnt = 0;
+
+	chip = get_chip(chip);
+	if(NULL == chip->chip)
+		return(-1);
+
+	// lines already requested are set to the value, the rest are
+	// requested together
+	for(i = 0; i < count; i++)
+	{
+		offset = pins[i];
+		if(offset < 0 || offset >= GPIO_PIN_CNT)
+			continue;
+		if(NULL != chip->ports[offset].request)
+		{
+			setGPIOChipValue(chip, offset, value);
+			continue;
+		}
+		for(j = 0; j < new_cnt && new_pins[j] != offset; j++)
+			;
+		if(j < new_cnt || new_cnt == GPIO_MAX_PINS)
+			continue; // duplicate pin, or too many pins
+
+		line_offset = get_line_offset(chip, offset);
+		if(-1 == line_offset)
+			continue;
+		new_pins[new_cnt] = offset;
+		line_offsets[new_cnt] = line_offset;
+		new_cnt++;
+	}
+	if(0 == new_cnt)
+		return(0);
+
+	request = request_output_lines(chip->chip, line_offsets, new_cnt,
+		value ? GPIOD_LINE_VALUE_ACTIVE : GPIOD_LINE_VALUE_INACTIVE,
+		"u8g2arm");
+	if(NULL == request)
+	{
+		perror("gpiod_chip_request_lines");
+		return(-1);
+	}
+	for(i = 0; i < new_cnt; i++)
+	{
+		chip->ports[new_pins[i]].request = request;
+		chip->ports[new_pins[i]].line_offset = line_offsets[i];
+		chip->ports[new_pins[i]].direction = GPIO_OUT;
+	}
+	return(0);
+}
+
+int setGPIOChipValue(gpio_chip_t *chip, int pin, int value)
+{
+	int offset = pin;
+	if(pin < 0 || pin >= GPIO_PIN_CNT)
+		return(-1);
+	chip = get_chip(chip);
+	// fprintf(stderr, "%s(%i, %i)(request=%p)" "\n", __func__, pin, value, chip->ports[offset].request);
+	if(NULL != chip->ports[offset].request)
+	{
+		gpiod_line_request_set_value(chip->ports[offset].request, chip->ports[offset].line_offset, value);
+		// perror("gpiod_line_request_set_value()");
+	}
+	return(0);
+}
+
+int setGPIOChipValues(gpio_chip_t *chip, const int *pins, const int *values,
+                      int count)
+{
+	unsigned int line_offsets[GPIO_MAX_PINS];
+	enum gpiod_line_value line_values[GPIO_MAX_PINS];
+	char done[GPIO_MAX_PINS] = { 0 };
+	struct gpiod_line_request *request;
+	int i, j, num, offset;
+
+	chip = get_chip(chip);
+	if(count > GPIO_MAX_PINS)
+		count = GPIO_MAX_PINS;
+
+	// one call for each request the pins belong to, usually just one
+	for(i = 0; i < count; i++)
+	{
+		if(done[i] || pins[i] < 0 || pins[i] >= GPIO_PIN_CNT)
+			continue;
+		request = chip->ports[pins[i]].request;
+		num = 0;
+		for(j = i; j < count; j++)
+		{
+			offset = pins[j];
+			if(offset < 0 || offset >= GPIO_PIN_CNT)
+				continue;
+			if(!done[j] && chip->ports[offset].request == request)
+			{
+				line_offsets[num] = chip->ports[offset].line_offset;
+				line_values[num] = values[j] ? GPIOD_LINE_VALUE_ACTIVE
+				                             : GPIOD_LINE_VALUE_INACTIVE;
+				done[j] = 1;
+				num++;
+			}
+		}
+		if(NULL != request)
+			gpiod_line_request_set_values_subset(request, num, line_offsets,
+			                                     line_values);
+	}
+	return(0);
+}
+
+int exportGPIOOutputs(const int *pins, int count, int value)
+{
+	return exportGPIOChipOutputs(NULL, pins, count, value);
+}
 
+int setGPIOValues(const int *pins, const int *values, int count)
+{
+	return setGPIOChipValues(NULL, pins, values, count);
+}
+
+#endif
@@ -47,13 +47,31 @@ void setI2CSlave(int i2c_fd,int addr)
     }
 }
 
-void I2CWriteBytes(int i2c_fd, uint8_t* data, uint8_t length)
+// Returns 0, or -1 if the transfer failed
+int I2CWriteBytes(int i2c_fd, uint8_t* data, uint16_t length)
 {
     if (write(i2c_fd, data, length) != length) 
 	{
         /* ERROR HANDLING: i2c transaction failed */
         printf("Failed to write to the i2c bus.\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Returns 0, or -1 if the transfers failed
+int I2CWriteMessages(int i2c_fd, struct i2c_msg* msgs, uint32_t count)
+{
+    struct i2c_rdwr_ioctl_data rdwr;
+    rdwr.msgs = msgs;
+    rdwr.nmsgs = count;
+    if (ioctl(i2c_fd, I2C_RDWR, &rdwr) < 0)
+	{
+        /* ERROR HANDLING: i2c transaction failed */
+        printf("Failed to write messages to the i2c bus.\n");
+        return -1;
     }
+    return 0;
 }
 
 void sleep_ms(unsigned long milliseconds)
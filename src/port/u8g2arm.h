@@ -30,15 +30,22 @@ extern "C" {
 
 
 #include "../csrc/u8g2.h"
+#include "async.h"
+#include "delay.h"
 #include "gpio.h"
 #include "i2c.h"
 #include "spi.h"
 
 // Initialize the U8X8 user pointer to hold hardware device details
-// when using hardware I2C or SPI drivers.
+// when using hardware I2C or SPI drivers, or the GPIO chip of a display.
 // The details are held in dynamic memory pointed to by the U8X8 user
-// pointer (u8x8_GetUserPtr(u8x8)), and can be freed when all access to
-// the display has finished
+// pointer (u8x8_GetUserPtr(u8x8)), and are freed, closing the devices
+// and releasing the GPIO lines, with u8g2arm_arm_free() when all access
+// to the display has finished. Each display with its own details can be
+// used from a separate thread. A display that is set up again with one
+// of the byte drivers below keeps its details, which the init functions
+// reuse or replace. Free them before setting the display up with
+// another byte driver.
 
 // Initialize hardware SPI driver
 int u8g2arm_arm_init_hw_spi(u8x8_t *u8x8, int bus_number, int cs_number,
@@ -47,10 +54,56 @@ int u8g2arm_arm_init_hw_spi(u8x8_t *u8x8, int bus_number, int cs_number,
 // Initialize hardware I2C driver
 int u8g2arm_arm_init_hw_i2c(u8x8_t *u8x8, int bus_number);
 
+// Give a display its own GPIO chip, e.g. "/dev/gpiochip4" (NULL for
+// /dev/gpiochip0). Call after the hardware init function, if used.
+// Returns 0 if the display does not use one of the byte drivers below.
+int u8g2arm_arm_init_gpio(u8x8_t *u8x8, const char *chip_path);
+
+// Free the details held in the U8X8 user pointer (nothing is done if
+// the display does not use one of the byte drivers below)
+void u8g2arm_arm_free(u8x8_t *u8x8);
+
+// Returns 1 if the display uses one of the byte drivers below, which
+// hold their details in the U8X8 user pointer
+int u8g2arm_arm_is_port_byte_cb(u8x8_t *u8x8);
+
+// Transmit modes for the hardware SPI and I2C drivers
+//   U8G2ARM_TX_BYTE  - SPI: send each byte in its own transfer
+//                      I2C: send each transfer with its own write
+//   U8G2ARM_TX_BATCH - SPI: hold the bytes of a transfer and send them in
+//                      a single ioctl when the transfer ends
+//                      I2C: hold each transfer as a message, and send the
+//                      held messages with a single I2C_RDWR ioctl when
+//                      u8g2arm_arm_flush() is called, when a delay or
+//                      GPIO change is requested, or when the buffer fills
+#define U8G2ARM_TX_BYTE  0
+#define U8G2ARM_TX_BATCH 1
+
+// Set the transmit mode (call after the init function, the default
+// mode is U8G2ARM_TX_BATCH for SPI and U8G2ARM_TX_BYTE for I2C)
+int u8g2arm_arm_set_tx_mode(u8x8_t *u8x8, int mode);
+
+// Use u8x8_cad_ssd13xx_linux_i2c in place of the SSD13xx I2C CAD set by
+// the display setup function (call after u8g2arm_arm_init_hw_i2c(),
+// returns 0 if the display does not use the hardware I2C driver and an
+// SSD13xx I2C CAD)
+int u8g2arm_arm_use_linux_i2c_cad(u8x8_t *u8x8);
+
+// Send any bytes held by the hardware driver, e.g. after
+// u8g2_SendBuffer() to send a whole frame in U8G2ARM_TX_BATCH mode.
+// Returns 0 if an I2C transfer failed or was too long to send since the
+// previous call, and 1 for a display on another byte driver.
+int u8g2arm_arm_flush(u8x8_t *u8x8);
+
 
 uint8_t u8x8_arm_linux_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_byte_arm_linux_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_byte_arm_linux_3wire_sw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_byte_arm_linux_sw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_byte_arm_linux_4wire_sw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_byte_arm_linux_8bit_8080mode(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_cad_ssd13xx_linux_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 
 #ifdef __cplusplus
 }